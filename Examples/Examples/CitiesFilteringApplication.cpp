@@ -57,7 +57,7 @@ namespace Examples
             cities.push_back( newCity );
         }
 
-        void RemoveCity( City cityToRemove )
+        void RemoveCity( const City& cityToRemove )
         {
             cities.Remove( cityToRemove );
         }
@@ -69,9 +69,9 @@ namespace Examples
             return sortedCities[0].Name();
         }
 
-        City FindByName( std::string name )
+        City FindByName( const std::string& name )
         {
-            return cities.Find( [=]( City c )->bool
+            return cities.Find( [&]( const City& c )->bool
                 {
                     return c.Name() == name;
                 } );
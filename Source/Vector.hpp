@@ -8,864 +8,5329 @@
 #include <algorithm>
 #include <functional>
 #include <array>
+#include <type_traits>
+#include <iterator>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <memory_resource>
+#include <exception>
+#include <utility>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <cassert>
+#include <unordered_set>
+#include <optional>
+#include <tuple>
+#if defined( _MSC_VER ) && (defined( _M_X64 ) || defined( _M_IX86 ))
+#include <xmmintrin.h>
+#endif
+#if defined( __SSE2__ ) || defined( _M_X64 ) || (defined( _M_IX86_FP ) && _M_IX86_FP >= 2)
+#define CX_VECTOR_SSE2
+#include <immintrin.h>
+#if defined( __GNUC__ ) || defined( __clang__ )
+#define CX_VECTOR_TARGET_AVX2 __attribute__(( target( "avx2" ) ))
+#define CX_VECTOR_TARGET_AVX512 __attribute__(( target( "avx512f,avx512bw" ) ))
+#else
+#include <intrin.h>
+#define CX_VECTOR_TARGET_AVX2
+#define CX_VECTOR_TARGET_AVX512
+#endif
+#endif
 
 
 namespace Cx
 {
+    /// <summary>
+    /// Enables a member template only for callables which can be invoked with Args and return a value convertible to Result
+    /// </summary>
+    template<class Result, class Callable, class... Args>
+    using EnableIfInvocable = std::enable_if_t<std::is_invocable_r_v<Result, Callable&, Args...>, int>;
+
+    /// <summary>
+    /// Determines whether Range can be traversed with std::begin and std::end
+    /// </summary>
+    template<class Range, class = void>
+    struct IsRange : std::false_type {};
+
+    template<class Range>
+    struct IsRange<Range, std::void_t<decltype(std::begin( std::declval<Range&>() )), decltype(std::end( std::declval<Range&>() ))>> : std::true_type {};
+
+    /// <summary>
+    /// Determines whether the number of elements in Range can be obtained with std::size before traversing it
+    /// </summary>
+    template<class Range, class = void>
+    struct IsSizedRange : std::false_type {};
+
+    template<class Range>
+    struct IsSizedRange<Range, std::void_t<decltype(std::size( std::declval<Range&>() ))>> : std::true_type {};
+
+    /// <summary>
+    /// Enables a member template only for iterator types
+    /// </summary>
+    template<class Iterator>
+    using EnableIfIterator = std::enable_if_t<std::is_base_of_v<std::input_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category>, int>;
+
+    /// <summary>
+    /// Enables a member template only for range types other than Excluded and the types derived from it, which are expected to have a dedicated overload
+    /// </summary>
+    template<class Range, class Excluded>
+    using EnableIfRange = std::enable_if_t<IsRange<Range>::value && !std::is_base_of_v<Excluded, std::decay_t<Range>>, int>;
+
+
+    /// <summary>
+    /// Determines whether two constant T objects can be compared with operator&lt;
+    /// </summary>
+    template<class T, class = void>
+    struct IsLessThanComparable : std::false_type {};
+
     template<class T>
-    class Vector : public std::vector<T>
-    {
-    public:
-#pragma region Constructors
-        Vector() noexcept : std::vector<T>()
-        {}
+    struct IsLessThanComparable<T, std::void_t<decltype(std::declval<const T&>() < std::declval<const T&>())>> : std::true_type {};
 
-        Vector( std::initializer_list<T> initialValues ) noexcept : std::vector<T>( initialValues )
-        {}
+    /// <summary>
+    /// Determines whether Key can be ordered by the radix sort: integral types other than bool and IEEE 754 float and double
+    /// </summary>
+    template<class Key>
+    struct IsRadixSortable : std::bool_constant<
+        (std::is_integral_v<Key> && !std::is_same_v<Key, bool> && sizeof( Key ) <= sizeof( std::uint64_t )) ||
+        (std::is_floating_point_v<Key> && std::numeric_limits<Key>::is_iec559 && (sizeof( Key ) == sizeof( std::uint32_t ) || sizeof( Key ) == sizeof( std::uint64_t )))> {};
+
+    /// <summary>
+    /// Determines whether two objects of type T are equal exactly when all their bytes are equal, so that searching for them may compare bytes instead of calling operator==.
+    /// True for integral types other than bool, enumerations and pointers. Specialize it for trivially copyable types without padding whose operator== compares all members.
+    /// bool is excluded because std::vector&lt;bool&gt; packs its elements into bits and has no data() to search
+    /// </summary>
+    template<class T>
+    struct IsBitwiseEqualityComparable : std::bool_constant<(std::is_integral_v<T> && !std::is_same_v<T, bool>) || std::is_enum_v<T> || std::is_pointer_v<T>> {};
 
+
+    /// <summary>
+    /// Execution policy requesting the sequential version of an algorithm
+    /// </summary>
+    struct SequencedPolicy {};
+
+    /// <summary>
+    /// Execution policy requesting the parallel version of an algorithm, run on the default ExecutionContext
+    /// </summary>
+    struct ParallelPolicy {};
+
+    /// <summary>
+    /// Execution policy requesting the parallel version of an algorithm, run on the default ExecutionContext, which may also be vectorized
+    /// </summary>
+    struct ParallelUnsequencedPolicy {};
+
+    inline constexpr SequencedPolicy seq{};
+    inline constexpr ParallelPolicy par{};
+    inline constexpr ParallelUnsequencedPolicy par_unseq{};
+
+
+    /// <summary>
+    /// Pool of worker threads running the parallel algorithms of Vector.
+    /// Each worker owns a task queue and steals from the queues of other workers when its own one is empty.
+    /// </summary>
+    class ExecutionContext
+    {
+    public:
         /// <summary>
-        /// Initializes a new instance of the Vector class that is empty and has the specified initial capacity.
+        /// Initializes a new instance of the ExecutionContext class with the specified degree of parallelism
         /// </summary>
-        /// <param name="capacity">The number of elements that the new vector can initially store</param>
-        /// <returns></returns>
-        Vector( const int capacity ) : std::vector<T>( capacity )
+        /// <param name="threadCount">Number of threads taking part in the parallel algorithms, including the calling thread</param>
+        /// <param name="serialThreshold">Number of elements below which the algorithms run sequentially</param>
+        explicit ExecutionContext( const unsigned int threadCount = DefaultThreadCount(), const std::size_t serialThreshold = 1 << 15 )
+            : threadCount{ std::max( threadCount, 1u ) }, serialThreshold{ std::max<std::size_t>( serialThreshold, 1 ) }
         {
-            if( capacity < 0 )
-                throw std::invalid_argument( "capacity cannot be lower than 0" );
+            for( unsigned int i = 0; i < this->threadCount; ++i )
+                queues.push_back( std::make_unique<TaskQueue>() );
+            for( unsigned int i = 1; i < this->threadCount; ++i )
+                workers.emplace_back( [this, i]() { WorkerLoop( i ); } );
         }
-#pragma endregion
 
-#pragma region AddRange
-        /// <summary>
-        /// Adds all elements of the specified collection to the end of the Vector
-        /// </summary>
-        /// <param name="list">The collection whose elements should be added to the end of the Vector.</param>
-        void AddRange( const std::initializer_list<T>& list ) noexcept
+        ExecutionContext( const ExecutionContext& ) = delete;
+        ExecutionContext& operator=( const ExecutionContext& ) = delete;
+
+        ~ExecutionContext()
         {
-            for( auto element : list )
-                this->push_back( element );
+            {
+                std::lock_guard<std::mutex> lock( sleepMutex );
+                stopping = true;
+            }
+            wakeUp.notify_all();
+            for( auto& worker : workers )
+                worker.join();
         }
 
         /// <summary>
-        /// Adds all elements of the specified collection to the end of the Vector
+        /// Gets the context shared by the ParallelPolicy and ParallelUnsequencedPolicy overloads
         /// </summary>
-        /// <param name="range">The collection whose elements should be added to the end of the Vector.</param>
-        /// <param name="size">Number of elements in the range which should be added</param>
-        void AddRange( const T* const range, const unsigned int size ) noexcept
+        static ExecutionContext& Default()
         {
-            if( range != nullptr )
-                for( unsigned int i = 0; i < size; ++i )
-                    this->push_back( range[i] );
+            static ExecutionContext context;
+            return context;
         }
 
-        /// <summary>
-        /// Adds all elements of the specified collection to the end of the Vector
-        /// </summary>
-        /// <param name="vector">The collection given as another Vector, whose elements should be copied to the end of current Vector</param>
-        void AddRange( const Vector<T>& vector ) noexcept
+        static ExecutionContext* Select( const SequencedPolicy& ) noexcept { return nullptr; }
+        static ExecutionContext* Select( const ParallelPolicy& ) { return &Default(); }
+        static ExecutionContext* Select( const ParallelUnsequencedPolicy& ) { return &Default(); }
+        static ExecutionContext* Select( ExecutionContext& context ) noexcept { return &context; }
+
+        unsigned int ThreadCount() const noexcept
         {
-            for( auto element : vector )
-                this->push_back( element );
+            return threadCount;
         }
 
-        /// <summary>
-        /// Adds all elementa of the specified collection to the end of the Vector
-        /// </summary>
-        /// <param name="vector">The collection given as another Vector, whose elements should be moved to the end of current Vector</param>
-        void AddRange( Vector<T>&& vector ) noexcept
+        std::size_t SerialThreshold() const noexcept
         {
-            for( auto element : vector )
-                this->push_back( element );
+            return serialThreshold;
         }
 
-        /// <summary>
-        /// Adds all elements of the specified collection to the end of the Vector
-        /// </summary>
-        /// <param name="range">The collection given as std::array, whose elements should be moved to the end of current Vector</param>
-        template<std::size_t size>
-        void AddRange( const std::array<T, size>& range ) noexcept
+        void SetSerialThreshold( const std::size_t threshold ) noexcept
         {
-            for( auto element : range )
-                this->push_back( element );
+            serialThreshold = std::max<std::size_t>( threshold, 1 );
         }
 
         /// <summary>
-        /// Adds all elements of the specified collection to the end of the Vector
+        /// Queues the task for execution. Tasks queued from a worker of this context go to that worker's own queue
         /// </summary>
-        /// <param name="range">The collection given as std::array, whose elements should be moved to the end of current Vector</param>
-        template<std::size_t size>
-        void AddRange( std::array<T, size>&& range ) noexcept
+        void Submit( std::function<void()> task )
         {
-            for( auto element : range )
-                this->push_back( element );
+            {
+                std::lock_guard<std::mutex> lock( sleepMutex );
+                ++queuedTasks;
+            }
+            try
+            {
+                queues[CurrentQueueIndex()]->Push( std::move( task ) );
+            }
+            catch( ... )
+            {
+                --queuedTasks;
+                throw;
+            }
+            wakeUp.notify_one();
         }
-#pragma endregion
 
-#pragma region Contains
         /// <summary>
-        /// Determines whether an element is in the Vector
+        /// Runs one queued task on the calling thread, preferring its own queue and stealing from the others otherwise
         /// </summary>
-        /// <param name="item">The object to locate in the Vector</param>
-        /// <returns>true if item is found in the Vector, false otherwise</returns>
-        bool Contains( T item ) const noexcept
+        /// <returns>true if a task was run; false if all queues were empty</returns>
+        bool TryRunOne()
         {
-            for( auto it = this->begin(); it != this->end(); ++it )
-                if( *it == item )
-                    return true;
-            return false;
+            return TryRunOne( CurrentQueueIndex() );
         }
-#pragma endregion
 
-#pragma region Sort
         /// <summary>
-        /// Sorts the elements in the Vector using the default std::sort
+        /// Runs queued tasks on the calling thread until finished() returns true, sleeping while all queues are empty instead of spinning.
+        /// Whoever makes finished() true has to call NotifyWaiters() afterwards
         /// </summary>
-        void Sort()
+        template<class Predicate>
+        void RunUntil( Predicate&& finished )
         {
-            try
+            while( !finished() )
             {
-                std::sort( this->begin(), this->end() );
+                if( TryRunOne() )
+                    continue;
+                std::unique_lock<std::mutex> lock( sleepMutex );
+                wakeUp.wait( lock, [&]() { return finished() || queuedTasks > 0; } );
             }
-            catch( const std::exception& e ) { throw e; }
         }
 
         /// <summary>
-        /// Sorts a portion of the elements in the Vector using the default std::sort
+        /// Wakes the threads sleeping in RunUntil so that they check their condition again
         /// </summary>
-        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
-        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
-        void Sort( const unsigned int positionBegin, const unsigned int positionEnd )
+        void NotifyWaiters()
         {
-            Vector<T> vector;
-            for( unsigned int i = positionBegin; i <= positionEnd; ++i )
-                vector.push_back( this->at( i ) );
-            try
             {
-                std::sort( vector.begin(), vector.end() );
-                for( unsigned int i = positionBegin, j = 0; i < positionEnd; ++i, ++j )
-                    this->operator[]( i ) = vector.at( j );
-                this->operator[]( positionEnd ) = vector.at( vector.size() - 1 );
+                std::lock_guard<std::mutex> lock( sleepMutex );
             }
-            catch( std::exception& e ) { throw e; }
+            wakeUp.notify_all();
         }
 
-        /// <summary>
-        /// Sorts the elements in the Vector using the specified comparer
-        /// </summary>
-        /// <param name="comparer">Function determining the sort order</param>
-        void Sort( std::function<bool( T, T )> comparer )
+    private:
+        class TaskQueue
         {
-            try
+        public:
+            void Push( std::function<void()> task )
             {
-                std::sort( this->begin(), this->end(), comparer );
+                std::lock_guard<std::mutex> lock( mutex );
+                tasks.push_back( std::move( task ) );
             }
-            catch( std::exception& e ) { throw e; }
-        }
 
-        /// <summary>
-        /// Sorts a portion of the elements in the Vector using the specified comparer
-        /// </summary>
-        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
-        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
-        /// <param name="comparer">Function determining the sort order</param>
-        void Sort( const unsigned int positionBegin, const unsigned int positionEnd, std::function<bool( T, T )> comparer )
-        {
-            Vector<T> vector;
-            for( unsigned int i = positionBegin; i <= positionEnd; ++i )
-                vector.push_back( this->at( i ) );
-            try
+            bool PopBack( std::function<void()>& task )
             {
-                std::sort( vector.begin(), vector.end(), comparer );
-                for( unsigned int i = positionBegin, j = 0; i < positionEnd; ++i, ++j )
-                    this->operator[]( i ) = vector.at( j );
-                this->operator[]( positionEnd ) = vector.at( vector.size() - 1 );
+                std::lock_guard<std::mutex> lock( mutex );
+                if( tasks.empty() )
+                    return false;
+                task = std::move( tasks.back() );
+                tasks.pop_back();
+                return true;
             }
-            catch( std::exception& e ) { throw e; }
-        }
-#pragma endregion
 
-#pragma region Exists
-        /// <summary>
-        /// Determines whether the Vector contains elements that match the conditions defined by the specified predicate
-        /// </summary>
-        /// <param name="predicate">The predicate std::function delegate that defines the conditions of the elements to search for</param>
-        /// <returns>true if the Vector contains one or more elements that match the conditions defined by the specified predicate; false otherwise</returns>
-        const bool Exists( std::function<bool( T )> predicate ) const noexcept
+            bool StealFront( std::function<void()>& task )
+            {
+                std::lock_guard<std::mutex> lock( mutex );
+                if( tasks.empty() )
+                    return false;
+                task = std::move( tasks.front() );
+                tasks.pop_front();
+                return true;
+            }
+
+        private:
+            std::mutex mutex;
+            std::deque<std::function<void()>> tasks;
+        };
+
+        static unsigned int DefaultThreadCount() noexcept
         {
-            return std::find_if( this->begin(), this->end(), predicate ) != this->end();
+            return std::max( std::thread::hardware_concurrency(), 1u );
         }
-#pragma endregion
 
-#pragma region CopyTo
-        /// <summary>
-        /// Copies a range of elements from the Vector to a compatible one-dimensional array starting at the specified index of the target
-        /// </summary>
-        /// <param name="index">The zero-based index in the source Vector at which copying begins</param>
-        /// <param name="array">The one-dimensional array that is the destination of the elements copied from from Vector. The array must have zero-based indexing</param>
-        /// <param name="arrayIndex">The zero-based index in array at which copying begins</param>
-        /// <param name="count">The number of elements to copy</param>
-        void CopyTo( const unsigned int index, T* array, const unsigned int arrayIndex, const unsigned int count ) const
+        unsigned int CurrentQueueIndex() const noexcept
         {
-            if( array == nullptr )
-                throw std::invalid_argument( "array is nullptr" );
-            else if( index >= this->size() || (this->size() - index) > (count - arrayIndex) )
-                throw std::out_of_range( "index exceeds the size of Vector" );
-            for( unsigned int copiedElements = 0; copiedElements < count; ++copiedElements )
-                array[arrayIndex + copiedElements] = this->operator[]( index + copiedElements );
+            return currentContext == this ? currentIndex : 0;
         }
 
-        /// <summary>
-        /// Copies the entire Vector to a compatible one-dimensional array, starting at the beginning of the target array
-        /// </summary>
-        /// <param name="array">The one-dimensional array that is the destination of the elements copied from Vector</param>
-        /// <param name="size">Size of target array which the Vector's elements are copied to</param>
-        void CopyTo( T* array, const unsigned int size )
+        bool TryRunOne( const unsigned int index )
         {
-            if( array == nullptr )
-                throw std::invalid_argument( "array is nullptr" );
-            else if( size < this->size() )
-                throw std::invalid_argument( "destination smaller than source" );
-            for( unsigned int i = 0; i < this->size(); ++i )
-                array[i] = this->at( i );
+            std::function<void()> task;
+            bool found = queues[index]->PopBack( task );
+            for( unsigned int i = 1; !found && i < threadCount; ++i )
+                found = queues[(index + i) % threadCount]->StealFront( task );
+            if( !found )
+                return false;
+            --queuedTasks;
+            task();
+            return true;
         }
 
-        /// <summary>
-        /// Copies the entire Vector to a compatible one-dimensional array, starting at the specified index of the target array
-        /// </summary>
-        /// <param name="array">The one-dimensional array that is the destination of the elements copied from Vector</param>
-        /// <param name="size">Size of target array which the Vector's elements are copied to</param>
-        /// <param name="arrayIndex">The zero-based index in the array at which copying begins</param>
-        void CopyTo( T* array, const unsigned int size, unsigned int arrayIndex )
+        void WorkerLoop( const unsigned int index )
         {
-            if( array == nullptr )
-                throw std::invalid_argument( "array is nullptr" );
-            else if( size - arrayIndex < this->size() )
-                throw std::invalid_argument( "destination smaller than source" );
-            for( unsigned int i = 0; i < this->size(); ++i, ++arrayIndex )
-                array[arrayIndex] = this->at( i );
+            currentContext = this;
+            currentIndex = index;
+            while( true )
+            {
+                if( TryRunOne( index ) )
+                    continue;
+                std::unique_lock<std::mutex> lock( sleepMutex );
+                wakeUp.wait( lock, [this]() { return stopping || queuedTasks > 0; } );
+                if( stopping && queuedTasks == 0 )
+                    return;
+            }
         }
 
-        /// <summary>
-        /// Copies a range of elements from the Vector to a compatible one-dimensional array starting at the specified index of the target
-        /// </summary>
-        /// <param name="index">The zero-based index in the source Vector at which copying begins</param>
-        /// <param name="array">The destination std::vector where the elements are copied to from Vector.</param>
-        /// <param name="arrayIndex">The zero-based index in array at which copying begins</param>
-        /// <param name="count">The number of elements to copy</param>
-        void CopyTo( const unsigned int index, std::vector<T>& array, const unsigned int arrayIndex, const unsigned int count )
+        const unsigned int threadCount;
+        std::size_t serialThreshold;
+        std::vector<std::unique_ptr<TaskQueue>> queues;
+        std::vector<std::thread> workers;
+        std::mutex sleepMutex;
+        std::condition_variable wakeUp;
+        std::atomic<std::size_t> queuedTasks{ 0 };
+        bool stopping = false;
+
+        static inline thread_local const ExecutionContext* currentContext = nullptr;
+        static inline thread_local unsigned int currentIndex = 0;
+    };
+
+
+    /// <summary>
+    /// Set of tasks run on an ExecutionContext which can be waited for as a whole.
+    /// The waiting thread runs queued tasks itself, so tasks may safely spawn and wait for nested tasks.
+    /// </summary>
+    class TaskGroup
+    {
+    public:
+        explicit TaskGroup( ExecutionContext& context ) noexcept : context{ context }
+        {}
+
+        TaskGroup( const TaskGroup& ) = delete;
+        TaskGroup& operator=( const TaskGroup& ) = delete;
+
+        ~TaskGroup()
         {
-            if( index >= this->size() || arrayIndex >= array.size() )
-                throw std::out_of_range( "index exceeds the size of Vector" );
-            for( unsigned int copiedElements = 0; copiedElements < count; ++copiedElements )
-                array.insert( array.cbegin() + copiedElements + arrayIndex, this->operator[]( index + copiedElements ) );
+            context.RunUntil( [this]() { return pendingTasks == 0; } );
         }
 
-        /// <summary>
-        /// Copies the entire Vector to a compatible std::vector, starting at the beginning of the target array
-        /// </summary>
-        /// <param name="array">The std::vector that is the destination of the elements copied from Vector</param>
-        void CopyTo( std::vector<T>& array )
+        template<class Task>
+        void Run( Task&& task )
         {
-            for( unsigned int i = 0; i < this->size(); ++i )
-                array.insert( array.cbegin() + i, this->at( i ) );
+            // Counted before queueing, so that the task cannot finish before it is counted
+            ++pendingTasks;
+            try
+            {
+                context.Submit( [this, &context = context, task = std::forward<Task>( task )]() mutable
+                    {
+                        try
+                        {
+                            task();
+                        }
+                        catch( ... )
+                        {
+                            std::lock_guard<std::mutex> lock( exceptionMutex );
+                            if( !exception )
+                                exception = std::current_exception();
+                        }
+                        // The group may be destroyed as soon as the counter drops to zero, so only the context is used afterwards
+                        if( --pendingTasks == 0 )
+                            context.NotifyWaiters();
+                    } );
+            }
+            catch( ... )
+            {
+                --pendingTasks;
+                throw;
+            }
         }
 
         /// <summary>
-        /// Copies the entire Vector to a compatible std::vector, starting at the specified index of the target array
+        /// Waits until all tasks of the group are finished and rethrows the first exception thrown by any of them
         /// </summary>
-        /// <param name="array">The std::vector that is the destination of the elements copied from Vector</param>
-        /// <param name="arrayIndex">The zero-based index in the array at which copying begins</param>
-        void CopyTo( std::vector<T>& array, unsigned int arrayIndex )
+        void Wait()
         {
-            for( unsigned int i = 0; i < this->size(); ++i )
-                array.insert( array.cbegin() + i + arrayIndex, this->at( i ) );
+            context.RunUntil( [this]() { return pendingTasks == 0; } );
+            if( exception )
+                std::rethrow_exception( std::exchange( exception, nullptr ) );
         }
 
+    private:
+        ExecutionContext& context;
+        std::atomic<std::size_t> pendingTasks{ 0 };
+        std::mutex exceptionMutex;
+        std::exception_ptr exception;
+    };
+
+
+    /// <summary>
+    /// Determines whether Policy selects the execution of an algorithm: one of the execution policies or an ExecutionContext
+    /// </summary>
+    template<class Policy>
+    struct IsExecutionPolicy : std::bool_constant<
+        std::is_same_v<std::decay_t<Policy>, SequencedPolicy> ||
+        std::is_same_v<std::decay_t<Policy>, ParallelPolicy> ||
+        std::is_same_v<std::decay_t<Policy>, ParallelUnsequencedPolicy> ||
+        std::is_same_v<std::decay_t<Policy>, ExecutionContext>> {};
+
+    /// <summary>
+    /// Enables a member template only for execution policies and ExecutionContext
+    /// </summary>
+    template<class Policy>
+    using EnableIfExecutionPolicy = std::enable_if_t<IsExecutionPolicy<Policy>::value, int>;
+
+
+    /// <summary>
+    /// Bit scanning helpers shared by the search algorithms
+    /// </summary>
+    struct BitScan
+    {
         /// <summary>
-        /// Copies a range of elements from the Vector to a compatible one-dimensional array starting at the specified index of the target
+        /// Returns the number of zero bits below the lowest set bit of a non-zero value
         /// </summary>
-        /// <param name="index">The zero-based index in the source Vector at which copying begins</param>
-        /// <param name="array">The destination std::array where the elements are copied to from Vector.</param>
-        /// <param name="arrayIndex">The zero-based index in array at which copying begins</param>
-        /// <param name="count">The number of elements to copy</param>
-        template<std::size_t size>
-        void CopyTo( const unsigned int index, std::array<T, size>& array, const unsigned int arrayIndex, const unsigned int count )
+        static std::size_t CountTrailingZeros( const std::uint64_t value ) noexcept
         {
-            if( index >= this->size() || arrayIndex >= array.size() )
-                throw std::out_of_range( "index exceeds the size of Vector" );
-            for( unsigned int copiedElements = 0; copiedElements < count; ++copiedElements )
-                array[copiedElements + arrayIndex] = this->operator[]( index + copiedElements );
+#if defined( __GNUC__ ) || defined( __clang__ )
+            return static_cast<std::size_t>(__builtin_ctzll( value ));
+#else
+            std::size_t result = 0;
+            while( ((value >> result) & 1) == 0 )
+                ++result;
+            return result;
+#endif
         }
 
         /// <summary>
-        /// Copies the entire Vector to a compatible std::array, starting at the beginning of the target array
+        /// Returns the index of the highest set bit of a non-zero value
         /// </summary>
-        /// <param name="array">The std::array that is the destination of the elements copied from Vector</param>
-        template<std::size_t size>
-        void CopyTo( std::array<T, size>& array )
+        static std::size_t FloorLog2( const std::uint64_t value ) noexcept
         {
-            for( unsigned int i = 0; i < this->size(); ++i )
-                array[i] = this->at( i );
+#if defined( __GNUC__ ) || defined( __clang__ )
+            return static_cast<std::size_t>(63 - __builtin_clzll( value ));
+#else
+            std::size_t result = 0;
+            while( value >> (result + 1) )
+                ++result;
+            return result;
+#endif
         }
+    };
+
 
+    /// <summary>
+    /// Software prefetch shared by the search algorithms
+    /// </summary>
+    struct CacheHint
+    {
         /// <summary>
-        /// Copies the entire Vector to a compatible std::array, starting at the specified index of the target array
+        /// Asks the processor to start loading the cache line holding the address; a no-op where no prefetch instruction is available
         /// </summary>
-        /// <param name="array">The std::array that is the destination of the elements copied from Vector</param>
-        /// <param name="arrayIndex">The zero-based index in the array at which copying begins</param>
-        template<std::size_t size>
-        void CopyTo( std::array<T, size>& array, unsigned int arrayIndex )
+        static void Prefetch( const void* address ) noexcept
         {
-            for( unsigned int i = 0; i < this->size(); ++i )
-                array[i + arrayIndex] = this->at( i );
+#if defined( __GNUC__ ) || defined( __clang__ )
+            __builtin_prefetch( address );
+#elif defined( _MSC_VER ) && (defined( _M_X64 ) || defined( _M_IX86 ))
+            _mm_prefetch( static_cast<const char*>(address), _MM_HINT_T0 );
+#else
+            (void)address;
+#endif
         }
-#pragma endregion
+    };
 
-#pragma region Find
+
+    /// <summary>
+    /// Linear search kernels which compare a whole SSE2, AVX2 or AVX-512 register of elements per instruction.
+    /// The widest instruction set supported by the CPU is detected once, at the first search; other platforms use the scalar loop
+    /// </summary>
+    class SimdSearch
+    {
+    public:
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate, and returns the first occurrence within the entire Vector
+        /// Determines whether T can be searched by the vectorized kernels:
+        /// IEEE 754 float and double, which are compared by value, and the bitwise equality comparable types of 1, 2, 4 or 8 bytes
         /// </summary>
-        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
-        /// <returns>The first element that matches the conditions defined by the specified predicate if found; default T value otherwise</returns>
-        T Find( std::function<bool( T )> predicate )
-        {
-            if( predicate == nullptr )
-                throw std::invalid_argument( "predicate is nullptr" );
-
-            for( auto it = this->begin(); it != this->end(); ++it )
-                if( predicate( *it ) == true )
-                    return it.operator*();
-            return T();
-        }
-#pragma endregion
+        template<class T>
+        struct Supports : std::bool_constant<
+#if defined( CX_VECTOR_SSE2 )
+            (std::is_same_v<T, float> && std::numeric_limits<float>::is_iec559) ||
+            (std::is_same_v<T, double> && std::numeric_limits<double>::is_iec559) ||
+            (IsBitwiseEqualityComparable<T>::value && std::is_trivially_copyable_v<T> &&
+                (sizeof( T ) == 1 || sizeof( T ) == 2 || sizeof( T ) == 4 || sizeof( T ) == 8))
+#else
+            false
+#endif
+        > {};
 
-#pragma region RemoveAll
         /// <summary>
-        /// Removes all the elements that match the conditions defined by the specified predicate
+        /// Returns the index of the first element equal to value in the count elements starting at data, or count if there is none
         /// </summary>
-        /// <param name="predicate">The std::function delegate that defines the conditions of the elements to remove</param>
-        /// <returns></returns>
-        void RemoveAll( std::function<bool( T )> predicate ) noexcept
+        template<class T>
+        static std::size_t Find( const T* data, const std::size_t count, const T& value ) noexcept
         {
-            this->erase( std::remove_if( this->begin(), this->end(), predicate ), this->end() );
+            using Lane = LaneOf<T>;
+            Lane lane;
+            std::memcpy( &lane, &value, sizeof( Lane ) );
+            const auto* bytes = reinterpret_cast<const char*>(data);
+#if defined( CX_VECTOR_SSE2 )
+            switch( DetectedLevel() )
+            {
+            case Level::Avx512: return FindAvx512( bytes, count, lane );
+            case Level::Avx2: return FindAvx2( bytes, count, lane );
+            default: return FindSse2( bytes, count, lane );
+            }
+#else
+            return FindScalar( bytes, 0, count, lane );
+#endif
         }
-#pragma endregion
 
-#pragma region TrueForAll
         /// <summary>
-        /// Determines whether every element in the Vector matches the conditions defined by the specified predicate
+        /// Returns the index of the last element equal to value in the count elements starting at data, or count if there is none
         /// </summary>
-        /// <param name="predicate">The std::function delegate that defines the conditions to check whether all elements meets the criteria</param>
-        /// <returns>true if every element in the Vector matches the conditions defined by the predicate; false otherwise</returns>
-        const bool TrueForAll( std::function<bool( T )> predicate )
+        template<class T>
+        static std::size_t FindLast( const T* data, const std::size_t count, const T& value ) noexcept
         {
-            if( predicate == nullptr )
-                throw std::invalid_argument( "predicate is null" );
-            for( auto it = this->cbegin(); it != this->cend(); ++it )
-                if( predicate( *it ) == false )
-                    return false;
-            return true;
+            using Lane = LaneOf<T>;
+            Lane lane;
+            std::memcpy( &lane, &value, sizeof( Lane ) );
+            const auto* bytes = reinterpret_cast<const char*>(data);
+#if defined( CX_VECTOR_SSE2 )
+            switch( DetectedLevel() )
+            {
+            case Level::Avx512: return FindLastAvx512( bytes, count, lane );
+            case Level::Avx2: return FindLastAvx2( bytes, count, lane );
+            default: return FindLastSse2( bytes, count, lane );
+            }
+#else
+            return FindLastScalar( bytes, count, count, lane );
+#endif
         }
-#pragma endregion
 
-#pragma region BinarySearch
-        /// <summary>
-        /// Searches the entire sorted Vector for an element using the default comparer and returns the zero-based index of the element
-        /// </summary>
-        /// <param name="item">The object to locate</param>
-        /// <returns>The zero-based index of item in the sorted Vector if item is found; otherwise -1</returns>
-        const int BinarySearch( T item ) noexcept
+    private:
+        template<class T>
+        using LaneOf = std::conditional_t<std::is_floating_point_v<T>, T,
+            std::conditional_t<sizeof( T ) == 1, std::uint8_t,
+            std::conditional_t<sizeof( T ) == 2, std::uint16_t,
+            std::conditional_t<sizeof( T ) == 4, std::uint32_t, std::uint64_t>>>>;
+
+        template<class Lane>
+        static std::size_t FindScalar( const char* bytes, std::size_t index, const std::size_t count, const Lane value ) noexcept
         {
-            return BinarySearchGenericImplementation( item, [&]( T element )->bool { return element == item; }, 0, this->size() - 1 );
+            for( ; index < count; ++index )
+            {
+                Lane element;
+                std::memcpy( &element, bytes + index * sizeof( Lane ), sizeof( Lane ) );
+                if( element == value )
+                    return index;
+            }
+            return count;
         }
 
-        /// <summary>
-        /// Searches the entire sorted Vector for an element using the specified comparer
-        /// </summary>
-        /// <param name="item">The object to locate</param>
-        /// <param name="predicate">The std::function predicate to use when comapring elements</param>
-        /// <returns>The zero-based index of item in the sorted Vector if item is found; -1 otherwise</returns>
-        const bool BinarySearch( T item, std::function<bool( T )> predicate ) noexcept
+        template<class Lane>
+        static std::size_t FindLastScalar( const char* bytes, std::size_t end, const std::size_t count, const Lane value ) noexcept
         {
-            return BinarySearchGenericImplementation( item, predicate, 0, this->size() - 1 );
+            while( end > 0 )
+            {
+                Lane element;
+                std::memcpy( &element, bytes + --end * sizeof( Lane ), sizeof( Lane ) );
+                if( element == value )
+                    return end;
+            }
+            return count;
         }
 
-        /// <summary>
-        /// Searches a range of elements in the sorted Vector for an element using the specified comparer
-        /// </summary>
-        /// <param name="item">The object to locate</param>
-        /// <param name="start">The zero-based starting index of the range to search</param>
-        /// <param name="count">The length of the range to search</param>
-        /// <param name="predicate">The std::function predicate to use when comparing elements</param>
-        /// <returns>The zero-based index of item in the sorted Vector if item is found; -1 otherwise</returns>
-        const bool BinarySearch( T item, const unsigned int start, const unsigned int count, std::function<bool( T )> predicate )
+#if defined( CX_VECTOR_SSE2 )
+        enum class Level { Sse2, Avx2, Avx512 };
+
+        static Level DetectedLevel() noexcept
         {
-            return BinarySearchGenericImplementation( item, predicate, start, count );
+            static const Level level = []()
+            {
+#if defined( __GNUC__ ) || defined( __clang__ )
+                __builtin_cpu_init();
+                if( __builtin_cpu_supports( "avx512f" ) && __builtin_cpu_supports( "avx512bw" ) )
+                    return Level::Avx512;
+                if( __builtin_cpu_supports( "avx2" ) )
+                    return Level::Avx2;
+#elif defined( _MSC_VER )
+                int info[4];
+                __cpuid( info, 1 );
+                const bool osSavesAvx = (info[2] & (1 << 27)) != 0 && (_xgetbv( 0 ) & 0x6) == 0x6;
+                const bool osSavesAvx512 = osSavesAvx && (_xgetbv( 0 ) & 0xE6) == 0xE6;
+                __cpuidex( info, 7, 0 );
+                if( osSavesAvx512 && (info[1] & (1 << 16)) != 0 && (info[1] & (1 << 30)) != 0 )
+                    return Level::Avx512;
+                if( osSavesAvx && (info[1] & (1 << 5)) != 0 )
+                    return Level::Avx2;
+#endif
+                return Level::Sse2;
+            }();
+            return level;
         }
-#pragma endregion
 
-#pragma region Remove
-        /// <summary>
-        /// Removes the first occurrence of a specific object from the Vector
-        /// </summary>
-        /// <param name="item">The object to remove from the Vector</param>
-        /// <returns></returns>
-        void Remove( T item ) noexcept
+        template<class Lane>
+        struct Lanes;
+
+        template<class Lane>
+        static std::size_t FindSse2( const char* bytes, const std::size_t count, const Lane value ) noexcept
         {
-            auto it = std::find( this->cbegin(), this->cend(), item );
-            this->erase( it );
+            constexpr std::size_t width = sizeof( __m128i ) / sizeof( Lane );
+            const __m128i needle = Lanes<Lane>::Broadcast128( value );
+            std::size_t index = 0;
+            for( ; index + width <= count; index += width )
+            {
+                const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(bytes + index * sizeof( Lane )) );
+                const auto mask = static_cast<unsigned>(_mm_movemask_epi8( Lanes<Lane>::Equal128( block, needle ) ));
+                if( mask != 0 )
+                    return index + BitScan::CountTrailingZeros( mask ) / sizeof( Lane );
+            }
+            return FindScalar( bytes, index, count, value );
         }
-#pragma endregion
 
-#pragma region FindLast
-        /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate, and returns the last occurrence within the entire Vector
-        /// </summary>
-        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
-        /// <returns>The last element that matches the conditions defined by the specified predicate if found; default T() otherwise</returns>
-        T FindLast( std::function<bool( T )> predicate ) const noexcept
+        template<class Lane>
+        static std::size_t FindLastSse2( const char* bytes, const std::size_t count, const Lane value ) noexcept
         {
-            auto resultInstance = T();
-            for( auto it = this->cbegin(); it != this->cend(); ++it )
-                if( predicate( *it ) )
-                    resultInstance = *it;
-            return resultInstance;
+            constexpr std::size_t width = sizeof( __m128i ) / sizeof( Lane );
+            const __m128i needle = Lanes<Lane>::Broadcast128( value );
+            std::size_t end = count;
+            for( ; end >= width; end -= width )
+            {
+                const __m128i block = _mm_loadu_si128( reinterpret_cast<const __m128i*>(bytes + (end - width) * sizeof( Lane )) );
+                const auto mask = static_cast<unsigned>(_mm_movemask_epi8( Lanes<Lane>::Equal128( block, needle ) ));
+                if( mask != 0 )
+                    return end - width + BitScan::FloorLog2( mask ) / sizeof( Lane );
+            }
+            return FindLastScalar( bytes, end, count, value );
         }
-#pragma endregion
 
-#pragma region RemoveRange
         /// <summary>
-        /// Removes a range of elements from the Vector
+        /// Compares four registers per iteration and looks for the matching lane only in the iteration which found one
         /// </summary>
-        /// <param name="start">The zero-based starting index of the range of elements to remove</param>
-        /// <param name="count">The number of elements to remove</param>
-        void RemoveRange( const unsigned int start, const unsigned int count )
+        template<class Lane>
+        CX_VECTOR_TARGET_AVX2 static std::size_t FindAvx2( const char* bytes, const std::size_t count, const Lane value ) noexcept
         {
-            if( start + count > this->size() )
-                throw std::invalid_argument( "range exceeds the container size" );
-            this->erase( this->cbegin() + start, this->cbegin() + start + count );
+            constexpr std::size_t width = sizeof( __m256i ) / sizeof( Lane );
+            const __m256i needle = Lanes<Lane>::Broadcast256( value );
+            std::size_t index = 0;
+            for( ; index + 4 * width <= count; index += 4 * width )
+            {
+                const auto* block = reinterpret_cast<const __m256i*>(bytes + index * sizeof( Lane ));
+                const __m256i equal0 = Lanes<Lane>::Equal256( _mm256_loadu_si256( block ), needle );
+                const __m256i equal1 = Lanes<Lane>::Equal256( _mm256_loadu_si256( block + 1 ), needle );
+                const __m256i equal2 = Lanes<Lane>::Equal256( _mm256_loadu_si256( block + 2 ), needle );
+                const __m256i equal3 = Lanes<Lane>::Equal256( _mm256_loadu_si256( block + 3 ), needle );
+                if( _mm256_movemask_epi8( _mm256_or_si256( _mm256_or_si256( equal0, equal1 ), _mm256_or_si256( equal2, equal3 ) ) ) != 0 )
+                    break;
+            }
+            for( ; index + width <= count; index += width )
+            {
+                const __m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(bytes + index * sizeof( Lane )) );
+                const auto mask = static_cast<unsigned>(_mm256_movemask_epi8( Lanes<Lane>::Equal256( block, needle ) ));
+                if( mask != 0 )
+                    return index + BitScan::CountTrailingZeros( mask ) / sizeof( Lane );
+            }
+            return FindScalar( bytes, index, count, value );
         }
-#pragma endregion
 
-#pragma region IndexOf
-        /// <summary>
-        /// Searches for the specified object and returns the zero-based index of the first occurrence within the entire Vector
-        /// </summary>
-        /// <param name="element">The object to locate in the Vector</param>
-        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
-        const int IndexOf( T element ) const
+        template<class Lane>
+        CX_VECTOR_TARGET_AVX2 static std::size_t FindLastAvx2( const char* bytes, const std::size_t count, const Lane value ) noexcept
         {
-            try
+            constexpr std::size_t width = sizeof( __m256i ) / sizeof( Lane );
+            const __m256i needle = Lanes<Lane>::Broadcast256( value );
+            std::size_t end = count;
+            for( ; end >= width; end -= width )
             {
-                return IndexOfGenericImplementation( element, 0, this->size() );
+                const __m256i block = _mm256_loadu_si256( reinterpret_cast<const __m256i*>(bytes + (end - width) * sizeof( Lane )) );
+                const auto mask = static_cast<unsigned>(_mm256_movemask_epi8( Lanes<Lane>::Equal256( block, needle ) ));
+                if( mask != 0 )
+                    return end - width + BitScan::FloorLog2( mask ) / sizeof( Lane );
             }
-            catch( const std::invalid_argument& e ) { throw e; }
+            return FindLastScalar( bytes, end, count, value );
         }
 
-        /// <summary>
-        /// Searches for the specified object and returns the zero-based index of the first occurrence within the range of elements in the Vector that extends from the specified index to the last element
-        /// </summary>
-        /// <param name="element">The object to locate in the Vector</param>
-        /// <param name="start">The zero-based starting index of the search</param>
-        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
-        const int IndexOf( T element, const unsigned int start ) const
+        template<class Lane>
+        CX_VECTOR_TARGET_AVX512 static std::size_t FindAvx512( const char* bytes, const std::size_t count, const Lane value ) noexcept
         {
-            try
+            constexpr std::size_t width = sizeof( __m512i ) / sizeof( Lane );
+            const __m512i needle = Lanes<Lane>::Broadcast512( value );
+            std::size_t index = 0;
+            for( ; index + width <= count; index += width )
             {
-                return IndexOfGenericImplementation( element, start, this->size() - start );
+                const __m512i block = _mm512_loadu_si512( bytes + index * sizeof( Lane ) );
+                const std::uint64_t mask = Lanes<Lane>::EqualMask512( block, needle );
+                if( mask != 0 )
+                    return index + BitScan::CountTrailingZeros( mask );
             }
-            catch( const std::invalid_argument& e ) { throw e; }
+            return FindScalar( bytes, index, count, value );
         }
 
-        /// <summary>
-        /// Searches for the specified object and returns the zero-based index of the first occurrence within the range of elements in the Vector that starts at the specified index and contains the specified number of elements
-        /// </summary>
-        /// <param name="element">The object to locate in the specified range within the Vector</param>
-        /// <param name="start">The zero-based starting index of the search</param>
-        /// <param name="count">The number of elements in the section to search</param>
-        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
-        const int IndexOf( T element, const unsigned int start, const unsigned int count ) const
+        template<class Lane>
+        CX_VECTOR_TARGET_AVX512 static std::size_t FindLastAvx512( const char* bytes, const std::size_t count, const Lane value ) noexcept
         {
-            try
+            constexpr std::size_t width = sizeof( __m512i ) / sizeof( Lane );
+            const __m512i needle = Lanes<Lane>::Broadcast512( value );
+            std::size_t end = count;
+            for( ; end >= width; end -= width )
             {
-                return IndexOfGenericImplementation( element, start, count );
+                const __m512i block = _mm512_loadu_si512( bytes + (end - width) * sizeof( Lane ) );
+                const std::uint64_t mask = Lanes<Lane>::EqualMask512( block, needle );
+                if( mask != 0 )
+                    return end - width + BitScan::FloorLog2( mask );
             }
-            catch( const std::invalid_argument& e ) { throw e; }
+            return FindLastScalar( bytes, end, count, value );
         }
-#pragma endregion
+#endif
+    };
+
+#if defined( CX_VECTOR_SSE2 )
+    template<>
+    struct SimdSearch::Lanes<std::uint8_t>
+    {
+        static __m128i Broadcast128( const std::uint8_t value ) noexcept { return _mm_set1_epi8( static_cast<char>(value) ); }
+        static __m128i Equal128( const __m128i left, const __m128i right ) noexcept { return _mm_cmpeq_epi8( left, right ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Broadcast256( const std::uint8_t value ) noexcept { return _mm256_set1_epi8( static_cast<char>(value) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Equal256( const __m256i left, const __m256i right ) noexcept { return _mm256_cmpeq_epi8( left, right ); }
+        CX_VECTOR_TARGET_AVX512 static __m512i Broadcast512( const std::uint8_t value ) noexcept { return _mm512_set1_epi8( static_cast<char>(value) ); }
+        CX_VECTOR_TARGET_AVX512 static std::uint64_t EqualMask512( const __m512i left, const __m512i right ) noexcept { return _mm512_cmpeq_epi8_mask( left, right ); }
+    };
+
+    template<>
+    struct SimdSearch::Lanes<std::uint16_t>
+    {
+        static __m128i Broadcast128( const std::uint16_t value ) noexcept { return _mm_set1_epi16( static_cast<short>(value) ); }
+        static __m128i Equal128( const __m128i left, const __m128i right ) noexcept { return _mm_cmpeq_epi16( left, right ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Broadcast256( const std::uint16_t value ) noexcept { return _mm256_set1_epi16( static_cast<short>(value) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Equal256( const __m256i left, const __m256i right ) noexcept { return _mm256_cmpeq_epi16( left, right ); }
+        CX_VECTOR_TARGET_AVX512 static __m512i Broadcast512( const std::uint16_t value ) noexcept { return _mm512_set1_epi16( static_cast<short>(value) ); }
+        CX_VECTOR_TARGET_AVX512 static std::uint64_t EqualMask512( const __m512i left, const __m512i right ) noexcept { return _mm512_cmpeq_epi16_mask( left, right ); }
+    };
+
+    template<>
+    struct SimdSearch::Lanes<std::uint32_t>
+    {
+        static __m128i Broadcast128( const std::uint32_t value ) noexcept { return _mm_set1_epi32( static_cast<int>(value) ); }
+        static __m128i Equal128( const __m128i left, const __m128i right ) noexcept { return _mm_cmpeq_epi32( left, right ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Broadcast256( const std::uint32_t value ) noexcept { return _mm256_set1_epi32( static_cast<int>(value) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Equal256( const __m256i left, const __m256i right ) noexcept { return _mm256_cmpeq_epi32( left, right ); }
+        CX_VECTOR_TARGET_AVX512 static __m512i Broadcast512( const std::uint32_t value ) noexcept { return _mm512_set1_epi32( static_cast<int>(value) ); }
+        CX_VECTOR_TARGET_AVX512 static std::uint64_t EqualMask512( const __m512i left, const __m512i right ) noexcept { return _mm512_cmpeq_epi32_mask( left, right ); }
+    };
+
+    template<>
+    struct SimdSearch::Lanes<std::uint64_t>
+    {
+        static __m128i Broadcast128( const std::uint64_t value ) noexcept { return _mm_set1_epi64x( static_cast<long long>(value) ); }
 
-#pragma region FindIndex
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector
+        /// SSE2 has no 64-bit comparison: both 32-bit halves of a lane have to be equal
         /// </summary>
-        /// <param name="predicate">The std::function predicate that defines the conditions of the element to search for</param>
-        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
-        const int FindIndex( std::function<bool( T )> predicate ) const
+        static __m128i Equal128( const __m128i left, const __m128i right ) noexcept
         {
-            try
+            const __m128i halves = _mm_cmpeq_epi32( left, right );
+            return _mm_and_si128( halves, _mm_shuffle_epi32( halves, _MM_SHUFFLE( 2, 3, 0, 1 ) ) );
+        }
+
+        CX_VECTOR_TARGET_AVX2 static __m256i Broadcast256( const std::uint64_t value ) noexcept { return _mm256_set1_epi64x( static_cast<long long>(value) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Equal256( const __m256i left, const __m256i right ) noexcept { return _mm256_cmpeq_epi64( left, right ); }
+        CX_VECTOR_TARGET_AVX512 static __m512i Broadcast512( const std::uint64_t value ) noexcept { return _mm512_set1_epi64( static_cast<long long>(value) ); }
+        CX_VECTOR_TARGET_AVX512 static std::uint64_t EqualMask512( const __m512i left, const __m512i right ) noexcept { return _mm512_cmpeq_epi64_mask( left, right ); }
+    };
+
+    template<>
+    struct SimdSearch::Lanes<float>
+    {
+        static __m128i Broadcast128( const float value ) noexcept { return _mm_castps_si128( _mm_set1_ps( value ) ); }
+        static __m128i Equal128( const __m128i left, const __m128i right ) noexcept { return _mm_castps_si128( _mm_cmpeq_ps( _mm_castsi128_ps( left ), _mm_castsi128_ps( right ) ) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Broadcast256( const float value ) noexcept { return _mm256_castps_si256( _mm256_set1_ps( value ) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Equal256( const __m256i left, const __m256i right ) noexcept { return _mm256_castps_si256( _mm256_cmp_ps( _mm256_castsi256_ps( left ), _mm256_castsi256_ps( right ), _CMP_EQ_OQ ) ); }
+        CX_VECTOR_TARGET_AVX512 static __m512i Broadcast512( const float value ) noexcept { return _mm512_castps_si512( _mm512_set1_ps( value ) ); }
+        CX_VECTOR_TARGET_AVX512 static std::uint64_t EqualMask512( const __m512i left, const __m512i right ) noexcept { return _mm512_cmp_ps_mask( _mm512_castsi512_ps( left ), _mm512_castsi512_ps( right ), _CMP_EQ_OQ ); }
+    };
+
+    template<>
+    struct SimdSearch::Lanes<double>
+    {
+        static __m128i Broadcast128( const double value ) noexcept { return _mm_castpd_si128( _mm_set1_pd( value ) ); }
+        static __m128i Equal128( const __m128i left, const __m128i right ) noexcept { return _mm_castpd_si128( _mm_cmpeq_pd( _mm_castsi128_pd( left ), _mm_castsi128_pd( right ) ) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Broadcast256( const double value ) noexcept { return _mm256_castpd_si256( _mm256_set1_pd( value ) ); }
+        CX_VECTOR_TARGET_AVX2 static __m256i Equal256( const __m256i left, const __m256i right ) noexcept { return _mm256_castpd_si256( _mm256_cmp_pd( _mm256_castsi256_pd( left ), _mm256_castsi256_pd( right ), _CMP_EQ_OQ ) ); }
+        CX_VECTOR_TARGET_AVX512 static __m512i Broadcast512( const double value ) noexcept { return _mm512_castpd_si512( _mm512_set1_pd( value ) ); }
+        CX_VECTOR_TARGET_AVX512 static std::uint64_t EqualMask512( const __m512i left, const __m512i right ) noexcept { return _mm512_cmp_pd_mask( _mm512_castsi512_pd( left ), _mm512_castsi512_pd( right ), _CMP_EQ_OQ ); }
+    };
+#endif
+
+
+    /// <summary>
+    /// Determines whether the Vectors returned by methods such as FindAll, GetRange and ConvertAll share the allocator of the source Vector.
+    /// Allocators bound to storage owned by the source Vector are selected with std::allocator_traits::select_on_container_copy_construction instead
+    /// </summary>
+    template<class Allocator>
+    struct SharesAllocatorWithResults : std::true_type {};
+
+    /// <summary>
+    /// Uninitialized storage for N elements of type T placed inside the object which owns it, handed out by InlineBufferAllocator
+    /// </summary>
+    template<class T, std::size_t N>
+    struct InlineBuffer
+    {
+        alignas(T) unsigned char bytes[sizeof( T ) * N];
+        bool inUse = false;
+    };
+
+    /// <summary>
+    /// Allocator which serves a request for at most N elements from the InlineBuffer it is bound to while that buffer is free, and every other request from the heap.
+    /// Default constructed and rebound allocators, as well as the ones selected for copies of a container, are not bound to any buffer and always use the heap
+    /// </summary>
+    template<class T, std::size_t N>
+    class InlineBufferAllocator
+    {
+    public:
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::false_type;
+        using propagate_on_container_move_assignment = std::false_type;
+        using propagate_on_container_swap = std::false_type;
+        using is_always_equal = std::false_type;
+
+        template<class U>
+        struct rebind
+        {
+            using other = InlineBufferAllocator<U, N>;
+        };
+
+        InlineBufferAllocator() noexcept = default;
+
+        explicit InlineBufferAllocator( InlineBuffer<T, N>* const buffer ) noexcept : buffer{ buffer }
+        {}
+
+        template<class U>
+        InlineBufferAllocator( const InlineBufferAllocator<U, N>& ) noexcept
+        {}
+
+        T* allocate( const std::size_t count )
+        {
+            if( buffer != nullptr && !buffer->inUse && count <= N )
             {
-                return FindIndexGenericImplementation( predicate, 0, this->size() );
+                buffer->inUse = true;
+                return reinterpret_cast<T*>(buffer->bytes);
             }
-            catch( const std::invalid_argument& e ) { throw e; }
+            return std::allocator<T>().allocate( count );
+        }
+
+        void deallocate( T* const pointer, const std::size_t count ) noexcept
+        {
+            if( buffer != nullptr && pointer == reinterpret_cast<T*>(buffer->bytes) )
+                buffer->inUse = false;
+            else
+                std::allocator<T>().deallocate( pointer, count );
+        }
+
+        InlineBufferAllocator select_on_container_copy_construction() const noexcept
+        {
+            return InlineBufferAllocator();
+        }
+
+        bool operator==( const InlineBufferAllocator& other ) const noexcept
+        {
+            return buffer == other.buffer;
+        }
+
+        bool operator!=( const InlineBufferAllocator& other ) const noexcept
+        {
+            return buffer != other.buffer;
         }
 
+    private:
+        InlineBuffer<T, N>* buffer = nullptr;
+    };
+
+    template<class T, std::size_t N>
+    struct SharesAllocatorWithResults<InlineBufferAllocator<T, N>> : std::false_type {};
+
+    /// <summary>
+    /// Extension of std::vector based on the .NET List, whose memory is allocated with Allocator
+    /// </summary>
+    template<class T, class Allocator = std::allocator<T>>
+    class Vector;
+
+    /// <summary>
+    /// Lazy sequence of values which is evaluated only by its terminal operations.
+    /// Every stage wraps the previous one, so the whole pipeline runs as a single loop over the source without intermediate containers,
+    /// and the loop stops as soon as the result of the terminal operation is known.
+    /// The source Vector has to outlive the query and must not be modified while the query is evaluated.
+    /// </summary>
+    /// <typeparam name="Reference">The type in which every value is passed from a stage to the next one</typeparam>
+    /// <typeparam name="Producer">The callable which passes the values to a consumer until the consumer returns false</typeparam>
+    template<class Reference, class Producer>
+    class LazyQuery
+    {
+    public:
+        using value_type = std::decay_t<Reference>;
+
+        LazyQuery( Producer producer, const std::size_t knownSize ) : producer{ std::move( producer ) }, knownSize{ knownSize }
+        {}
+
+#pragma region Stages
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that extends from the specified index to the last element
+        /// Filters the values of the query with the specified predicate
         /// </summary>
-        /// <param name="predicate">The std::function predicate that defines the conditions of the element to search for</param>
-        /// <param name="start">The zero-based starting index of the search</param>
-        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
-        const int FindIndex( std::function<bool( T )> predicate, const unsigned int start ) const
+        /// <param name="predicate">The callable that defines the conditions of the values to keep</param>
+        /// <returns>The query producing only the values that match the conditions</returns>
+        template<class Predicate, EnableIfInvocable<bool, const Predicate, Reference> = 0>
+        auto Where( Predicate predicate ) const
         {
-            try
+            auto filtered = [source = producer, predicate = std::move( predicate )]( auto&& consumer )
             {
-                return FindIndexGenericImplementation( predicate, start, this->size() - start );
-            }
-            catch( const std::invalid_argument& e ) { throw e; }
+                source( [&]( Reference value ) { return !predicate( value ) || consumer( std::forward<Reference>( value ) ); } );
+            };
+            return LazyQuery<Reference, decltype(filtered)>( std::move( filtered ), UnknownSize );
         }
 
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that starts at the specified index and contains the specified number of elements
+        /// Projects every value of the query with the specified selector
         /// </summary>
-        /// <param name="predicate">The std::function predicate that defines the conditions of the element to search for</param>
-        /// <param name="start">The zero-based starting index of the search</param>
-        /// <param name="count">The number of elements in the section to search</param>
-        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
-        const int FindIndex( std::function<bool( T )> predicate, const unsigned int start, const unsigned int count ) const
+        /// <param name="selector">The callable converting every value of the query</param>
+        /// <returns>The query producing the results of the selector</returns>
+        template<class Selector>
+        auto Select( Selector selector ) const
         {
-            try
+            using Result = std::invoke_result_t<const Selector&, Reference>;
+            auto selected = [source = producer, selector = std::move( selector )]( auto&& consumer )
             {
-                return FindIndexGenericImplementation( predicate, start, count );
-            }
-            catch( const std::invalid_argument& e ) { throw e; }
+                source( [&]( Reference value ) { return consumer( selector( std::forward<Reference>( value ) ) ); } );
+            };
+            return LazyQuery<Result, decltype(selected)>( std::move( selected ), knownSize );
         }
-#pragma endregion
 
-#pragma region Reverse
         /// <summary>
-        /// Reverses the order of the elements in the entire Vector
+        /// Limits the query to at most the specified number of its first values, stopping the source as soon as they are produced
         /// </summary>
-        /// <returns></returns>
-        void Reverse() noexcept
+        /// <param name="count">The maximal number of values to produce</param>
+        /// <returns>The query producing at most count values</returns>
+        auto Take( const std::size_t count ) const
         {
-            const auto swapRange = static_cast<int>(this->size() / 2);
-            for( auto swappedIndex = 0; swappedIndex < swapRange; ++swappedIndex )
-                std::swap( this->operator[]( swappedIndex ), this->operator[]( this->size() - 1 - swappedIndex ) );
+            auto taken = [source = producer, count]( auto&& consumer )
+            {
+                if( count == 0 )
+                    return;
+                std::size_t produced = 0;
+                source( [&]( Reference value ) { return consumer( std::forward<Reference>( value ) ) && ++produced < count; } );
+            };
+            return LazyQuery<Reference, decltype(taken)>( std::move( taken ), knownSize == UnknownSize ? UnknownSize : std::min( knownSize, count ) );
         }
 
         /// <summary>
-        /// Reverses the order of the elements in the specified range within the Vector
+        /// Bypasses the specified number of the first values of the query
         /// </summary>
-        /// <param name="start">The zero-based starting index of the range to reverse</param>
-        /// <param name="count">The number of elements in the range to reverse</param>
-        void Reverse( const unsigned int start, const unsigned int count )
+        /// <param name="count">The number of values to bypass</param>
+        /// <returns>The query producing the values which follow the first count values</returns>
+        auto Skip( const std::size_t count ) const
         {
-            if( start + count >= this->size() )
-                throw std::invalid_argument( "reverse range exceeds container size" );
-            for( unsigned int swappedIndex = 0; swappedIndex < count / 2; ++swappedIndex )
-                std::swap( this->operator[]( swappedIndex + start ), this->operator[]( start + count - swappedIndex - 1 ) );
+            auto skipped = [source = producer, count]( auto&& consumer )
+            {
+                std::size_t bypassed = 0;
+                source( [&]( Reference value ) { return bypassed++ < count || consumer( std::forward<Reference>( value ) ); } );
+            };
+            return LazyQuery<Reference, decltype(skipped)>( std::move( skipped ), knownSize == UnknownSize ? UnknownSize : knownSize - std::min( knownSize, count ) );
         }
 #pragma endregion
 
-#pragma region FindLastIndex
+#pragma region TerminalOperations
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector
+        /// Evaluates the query into a new Vector, reserving its storage up front whenever the number of values is known without evaluating the query
         /// </summary>
-        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
-        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
-        const int FindLastIndex( std::function<bool( T )> predicate ) const noexcept
+        /// <returns>A Vector containing all the values produced by the query</returns>
+        Vector<value_type> ToVector() const
         {
-            int index = 0;
-            int lastIndex = -1;
-            for( auto it = this->cbegin(); it != this->cend(); ++it, ++index )
-                if( predicate( *it ) )
-                    lastIndex = index;
-            return lastIndex;
+            Vector<value_type> results;
+            if( knownSize != UnknownSize )
+                results.reserve( knownSize );
+            producer( [&]( Reference value ) { results.push_back( std::forward<Reference>( value ) ); return true; } );
+            return results;
         }
 
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that extends from the first element to the specified index
+        /// Evaluates the query into a new Vector allocated with the specified allocator, reserving its storage up front whenever the number of values is known without evaluating the query
         /// </summary>
-        /// <param name="end">The zero-based starting index of the backward search</param>
-        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
-        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
-        const int FindLastIndex( const unsigned int end, std::function<bool( T )> predicate ) const
+        /// <param name="allocator">The allocator of the resulting Vector, for example a std::pmr::polymorphic_allocator of a request's memory resource</param>
+        /// <returns>A Vector containing all the values produced by the query</returns>
+        template<class Allocator>
+        Vector<value_type, Allocator> ToVector( const Allocator& allocator ) const
         {
-            if( end >= this->size() )
-                throw std::invalid_argument( "Ending index exceeds container size" );
-            int lastIndex = -1;
-            int index = 0;
-            for( auto it = this->cbegin(); it != this->cbegin() + end; ++it, ++index )
-                if( predicate( *it ) )
-                    lastIndex = index;
-            return lastIndex;
+            Vector<value_type, Allocator> results( allocator );
+            if( knownSize != UnknownSize )
+                results.reserve( knownSize );
+            producer( [&]( Reference value ) { results.push_back( std::forward<Reference>( value ) ); return true; } );
+            return results;
         }
 
         /// <summary>
-        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that contains the specified number of elements and ends at the specified index
+        /// Counts the values of the query. When no stage filters the values, the count is known without evaluating the query and no selector is called
         /// </summary>
-        /// <param name="start">The zero-based starting index of the backward search</param>
-        /// <param name="end">The zero-based ending index of the backward search</param>
-        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
-        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
-        const int FindLastIndex( const unsigned int start, const unsigned int end, std::function<bool( T )> predicate ) const
+        /// <returns>The number of values produced by the query</returns>
+        std::size_t Count() const
         {
-            if( start > end )
-                throw std::invalid_argument( "starting index bigger than ending index of search range" );
-            else if( end >= this->size() )
-                throw std::invalid_argument( "ending index exceeds container size" );
-            else if( start >= this->size() )
-                throw std::invalid_argument( "starting index is beyond the container size" );
-            int lastIndex = -1;
-            int index = 0;
-            for( auto it = this->cbegin() + start; it != this->cbegin() + end; ++it, ++index )
-                if( predicate( *it ) )
-                    lastIndex = index;
-            return lastIndex;
+            if( knownSize != UnknownSize )
+                return knownSize;
+            std::size_t count = 0;
+            producer( [&]( Reference ) { ++count; return true; } );
+            return count;
         }
-#pragma endregion
 
-#pragma region InsertRange
         /// <summary>
-        /// Inserts the elements of a collection into the Vector at the specified index
+        /// Counts the values of the query that match the conditions defined by the specified predicate
         /// </summary>
-        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
-        /// <param name="range">The collection given as pointer to buffer whose elements should be insterted into the Vector</param>
-        /// <param name="n">Number of elements in the collection</param>
-        void InsertRange( const unsigned int index, const T* const range, const unsigned int n )
+        /// <param name="predicate">The callable that defines the conditions of the values to count</param>
+        /// <returns>The number of values that match the conditions</returns>
+        template<class Predicate, EnableIfInvocable<bool, const Predicate, Reference> = 0>
+        std::size_t Count( Predicate predicate ) const
         {
-            if( range == nullptr )
-                throw std::invalid_argument( "range is nullptr" );
-            else if( index > this->size() )
-                throw std::invalid_argument( "insertion index beyond container size" );
-            for( auto i = 0u; i < n; ++i )
-                this->insert( this->cbegin() + index + i, range[i] );
+            return Where( std::move( predicate ) ).Count();
         }
 
         /// <summary>
-        /// Inserts the elements of a collection into the Vector at the specified index
+        /// Determines whether the query produces any value, stopping at the first one
         /// </summary>
-        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
-        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
-        void InsertRange( const unsigned int index, const std::vector<T>& range )
+        /// <returns>true if the query produces at least one value; false otherwise</returns>
+        bool Any() const
         {
-            try
-            {
-                InsertRange( index, range.data(), range.size() );
-            }
-            catch( std::invalid_argument& e ) { throw e; }
+            if( knownSize != UnknownSize )
+                return knownSize > 0;
+            bool found = false;
+            producer( [&]( Reference ) { found = true; return false; } );
+            return found;
         }
 
         /// <summary>
-        /// Inserts the elements of a collection into the Vector at the specified index
+        /// Determines whether any value of the query matches the conditions defined by the specified predicate, stopping at the first match
         /// </summary>
-        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
-        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
-        void InsertRange( const unsigned int index, std::vector<T>&& range )
+        /// <param name="predicate">The callable that defines the conditions of the value to search for</param>
+        /// <returns>true if any value matches the conditions; false otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, const Predicate, Reference> = 0>
+        bool Any( Predicate predicate ) const
         {
-            try
-            {
-                InsertRange( index, range.data(), range.size() );
-            }
-            catch( std::invalid_argument& e ) { throw e; }
+            return Where( std::move( predicate ) ).Any();
         }
 
         /// <summary>
-        /// Inserts the elements of a collection into the Vector at the specified index
+        /// Returns the first value of the query, stopping the evaluation right after it is produced
         /// </summary>
-        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
-        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
-        void InsertRange( const unsigned int index, const Vector<T>& range )
+        /// <returns>The first value produced by the query</returns>
+        value_type First() const
         {
-            try
-            {
-                InsertRange( index, range.data(), range.size() );
-            }
-            catch( std::invalid_argument& e ) { throw e; }
+            std::optional<value_type> first;
+            producer( [&]( Reference value ) { first.emplace( std::forward<Reference>( value ) ); return false; } );
+            if( !first )
+                throw std::logic_error( "the query does not produce any value" );
+            return std::move( *first );
         }
 
         /// <summary>
-        /// Inserts the elements of a collection into the Vector at the specified index
+        /// Returns the first value of the query that matches the conditions defined by the specified predicate, stopping the evaluation at the first match
         /// </summary>
-        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
-        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
-        void InsertRange( const unsigned int index, Vector<T>&& range )
+        /// <param name="predicate">The callable that defines the conditions of the value to search for</param>
+        /// <returns>The first value that matches the conditions</returns>
+        template<class Predicate, EnableIfInvocable<bool, const Predicate, Reference> = 0>
+        value_type First( Predicate predicate ) const
         {
-            try
-            {
-                InsertRange( index, range.data(), range.size() );
-            }
-            catch( std::invalid_argument& e ) { throw e; }
+            return Where( std::move( predicate ) ).First();
         }
-#pragma endregion
+
+        /// <summary>
+        /// Adds up all the values of the query, starting from a value-initialized value_type
+        /// </summary>
+        /// <returns>The sum of the values produced by the query</returns>
+        value_type Sum() const
+        {
+            value_type sum{};
+            producer( [&]( Reference value ) { sum += value; return true; } );
+            return sum;
+        }
+#pragma endregion
+
+    private:
+        static constexpr std::size_t UnknownSize = std::numeric_limits<std::size_t>::max();
+
+        Producer producer;
+        std::size_t knownSize;
+    };
+
+
+    template<class T, class Allocator>
+    class Vector : public std::vector<T, Allocator>
+    {
+    public:
+        using allocator_type = Allocator;
+
+        /// <summary>
+        /// Vector of Tout whose allocator is the allocator of this Vector rebound to Tout, as returned by ConvertAll
+        /// </summary>
+        template<class Tout>
+        using RebindVector = Vector<Tout, typename std::allocator_traits<Allocator>::template rebind_alloc<Tout>>;
+
+#pragma region Constructors
+        Vector() noexcept( noexcept( Allocator() ) ) : std::vector<T, Allocator>()
+        {}
+
+        /// <summary>
+        /// Initializes a new instance of the Vector class that is empty and allocates its elements with the specified allocator
+        /// </summary>
+        /// <param name="allocator">The allocator used for all the memory of the Vector</param>
+        explicit Vector( const Allocator& allocator ) noexcept : std::vector<T, Allocator>( allocator )
+        {}
+
+        Vector( std::initializer_list<T> initialValues, const Allocator& allocator = Allocator() ) noexcept : std::vector<T, Allocator>( initialValues, allocator )
+        {}
+
+        /// <summary>
+        /// Initializes a new instance of the Vector class that is empty and has the specified initial capacity.
+        /// </summary>
+        /// <param name="capacity">The number of elements that the new vector can initially store</param>
+        /// <param name="allocator">The allocator used for all the memory of the Vector</param>
+        /// <returns></returns>
+        Vector( const int capacity, const Allocator& allocator = Allocator() ) : std::vector<T, Allocator>( capacity, allocator )
+        {
+            if( capacity < 0 )
+                throw std::invalid_argument( "capacity cannot be lower than 0" );
+        }
+
+        /// <summary>
+        /// Initializes a new instance of the Vector class as a copy of the other Vector, allocated with the specified allocator
+        /// </summary>
+        Vector( const Vector& other, const Allocator& allocator ) : std::vector<T, Allocator>( other, allocator )
+        {}
+
+        /// <summary>
+        /// Initializes a new instance of the Vector class with the elements of the other Vector, allocated with the specified allocator.
+        /// The elements are moved one by one if the allocators are not equal
+        /// </summary>
+        Vector( Vector&& other, const Allocator& allocator ) : std::vector<T, Allocator>( std::move( other ), allocator )
+        {}
+#pragma endregion
+
+#pragma region AddRange
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="list">The collection whose elements should be added to the end of the Vector.</param>
+        void AddRange( const std::initializer_list<T>& list ) noexcept
+        {
+            this->insert( this->end(), list.begin(), list.end() );
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="range">The collection whose elements should be added to the end of the Vector.</param>
+        /// <param name="size">Number of elements in the range which should be added</param>
+        void AddRange( const T* const range, const unsigned int size ) noexcept
+        {
+            if( range != nullptr )
+                this->insert( this->end(), range, range + size );
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="vector">The collection given as another Vector, whose elements should be copied to the end of current Vector</param>
+        void AddRange( const Vector<T, Allocator>& vector ) noexcept
+        {
+            if( &vector == this )
+            {
+                const auto count = this->size();
+                this->reserve( 2 * count );
+                for( std::size_t i = 0; i < count; ++i )
+                    this->push_back( this->operator[]( i ) );
+                return;
+            }
+            this->insert( this->end(), vector.begin(), vector.end() );
+        }
+
+        /// <summary>
+        /// Adds all elementa of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="vector">The collection given as another Vector, whose elements should be moved to the end of current Vector. If current Vector is empty and can free the memory of the other one, its buffer is adopted</param>
+        void AddRange( Vector<T, Allocator>&& vector ) noexcept
+        {
+            if( this->empty() && CanAdoptBufferOf( vector ) )
+                this->swap( vector );
+            else
+                this->insert( this->end(), std::make_move_iterator( vector.begin() ), std::make_move_iterator( vector.end() ) );
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="range">The collection given as std::array, whose elements should be moved to the end of current Vector</param>
+        template<std::size_t size>
+        void AddRange( const std::array<T, size>& range ) noexcept
+        {
+            this->insert( this->end(), range.begin(), range.end() );
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="range">The collection given as std::array, whose elements should be moved to the end of current Vector</param>
+        template<std::size_t size>
+        void AddRange( std::array<T, size>&& range ) noexcept
+        {
+            this->insert( this->end(), std::make_move_iterator( range.begin() ), std::make_move_iterator( range.end() ) );
+        }
+
+        /// <summary>
+        /// Adds all elements of the range given as iterator pair to the end of the Vector
+        /// </summary>
+        /// <param name="first">Iterator to the first element which should be added</param>
+        /// <param name="last">Iterator past the last element which should be added</param>
+        template<class InputIterator, EnableIfIterator<InputIterator> = 0>
+        void AddRange( InputIterator first, InputIterator last )
+        {
+            this->insert( this->end(), first, last );
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector
+        /// </summary>
+        /// <param name="range">Any collection traversable with std::begin and std::end. Elements of an rvalue collection are moved</param>
+        template<class Range, EnableIfRange<Range, Vector<T, Allocator>> = 0>
+        void AddRange( Range&& range )
+        {
+            ReserveForRange( range );
+            if constexpr( std::is_rvalue_reference_v<Range&&> )
+                AddRange( std::make_move_iterator( std::begin( range ) ), std::make_move_iterator( std::end( range ) ) );
+            else
+                AddRange( std::begin( range ), std::end( range ) );
+        }
+#pragma endregion
+
+#pragma region Contains
+        /// <summary>
+        /// Determines whether an element is in the Vector
+        /// </summary>
+        /// <param name="item">The object to locate in the Vector</param>
+        /// <returns>true if item is found in the Vector, false otherwise</returns>
+        bool Contains( const T& item ) const noexcept
+        {
+            if constexpr( SimdSearch::Supports<T>::value )
+                return SimdSearch::Find( this->data(), this->size(), item ) != this->size();
+            for( auto it = this->begin(); it != this->end(); ++it )
+                if( *it == item )
+                    return true;
+            return false;
+        }
+#pragma endregion
+
+#pragma region Sort
+        /// <summary>
+        /// Sorts the elements in the Vector using the default std::sort
+        /// </summary>
+        void Sort()
+        {
+            if constexpr( IsRadixSortable<T>::value )
+            {
+                if( this->size() >= radixSortThreshold )
+                {
+                    RadixSort( *this, []( const T value ) { return RadixKey( value ); } );
+                    return;
+                }
+            }
+            std::sort( this->begin(), this->end() );
+        }
+
+        /// <summary>
+        /// Sorts a portion of the elements in the Vector using the default std::sort
+        /// </summary>
+        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
+        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
+        void Sort( const unsigned int positionBegin, const unsigned int positionEnd )
+        {
+            ValidateSortRange( positionBegin, positionEnd );
+            std::sort( this->begin() + positionBegin, this->begin() + positionEnd + 1 );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector using the specified comparer
+        /// </summary>
+        /// <param name="comparer">Function determining the sort order</param>
+        void Sort( std::function<bool( const T&, const T& )> comparer )
+        {
+            Sort<std::function<bool( const T&, const T& )>&>( comparer );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector using the specified comparer
+        /// </summary>
+        /// <param name="comparer">Callable determining the sort order, invoked directly so that it can be inlined</param>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        void Sort( Comparer&& comparer )
+        {
+            std::sort( this->begin(), this->end(), comparer );
+        }
+
+        /// <summary>
+        /// Sorts a portion of the elements in the Vector using the specified comparer
+        /// </summary>
+        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
+        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
+        /// <param name="comparer">Function determining the sort order</param>
+        void Sort( const unsigned int positionBegin, const unsigned int positionEnd, std::function<bool( const T&, const T& )> comparer )
+        {
+            Sort<std::function<bool( const T&, const T& )>&>( positionBegin, positionEnd, comparer );
+        }
+
+        /// <summary>
+        /// Sorts a portion of the elements in the Vector using the specified comparer
+        /// </summary>
+        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
+        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
+        /// <param name="comparer">Callable determining the sort order, invoked directly so that it can be inlined</param>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        void Sort( const unsigned int positionBegin, const unsigned int positionEnd, Comparer&& comparer )
+        {
+            ValidateSortRange( positionBegin, positionEnd );
+            std::sort( this->begin() + positionBegin, this->begin() + positionEnd + 1, comparer );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector using the default comparer and the specified execution policy
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should sort the Vector</param>
+        template<class Policy, EnableIfExecutionPolicy<Policy> = 0>
+        void Sort( Policy&& policy )
+        {
+            auto comparer = []( auto& left, auto& right )->bool { return left < right; };
+            ParallelSortGenericImplementation( ExecutionContext::Select( policy ), comparer );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector using the specified comparer and execution policy
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should sort the Vector</param>
+        /// <param name="comparer">Callable determining the sort order. It is called concurrently from several threads</param>
+        template<class Policy, class Comparer, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        void Sort( Policy&& policy, Comparer&& comparer )
+        {
+            ParallelSortGenericImplementation( ExecutionContext::Select( policy ), comparer );
+        }
+#pragma endregion
+
+#pragma region SortByKey
+        /// <summary>
+        /// Sorts the elements in the Vector in ascending order of the key extracted by the specified projection using the radix sort.
+        /// The sort is stable, so elements with equal keys keep their relative order
+        /// </summary>
+        /// <param name="projection">Callable returning the integral or floating-point key of an element</param>
+        template<class Projection, std::enable_if_t<IsRadixSortable<std::decay_t<std::invoke_result_t<Projection&, const T&>>>::value, int> = 0>
+        void SortByKey( Projection&& projection )
+        {
+            using Key = decltype(RadixKey( projection( std::declval<const T&>() ) ));
+            std::vector<std::pair<Key, std::size_t>> keys;
+            keys.reserve( this->size() );
+            for( std::size_t i = 0; i < this->size(); ++i )
+                keys.emplace_back( RadixKey( projection( this->operator[]( i ) ) ), i );
+            RadixSort( keys, []( const std::pair<Key, std::size_t>& key ) { return key.first; } );
+
+            std::vector<T, Allocator> sorted( this->get_allocator() );
+            sorted.reserve( this->size() );
+            for( const auto& key : keys )
+                sorted.push_back( std::move( this->operator[]( key.second ) ) );
+            this->swap( sorted );
+        }
+#pragma endregion
+
+#pragma region Exists
+        /// <summary>
+        /// Determines whether the Vector contains elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The predicate std::function delegate that defines the conditions of the elements to search for</param>
+        /// <returns>true if the Vector contains one or more elements that match the conditions defined by the specified predicate; false otherwise</returns>
+        const bool Exists( std::function<bool( const T& )> predicate ) const noexcept
+        {
+            return Exists<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Determines whether the Vector contains elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for, invoked directly so that it can be inlined</param>
+        /// <returns>true if the Vector contains one or more elements that match the conditions defined by the specified predicate; false otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const bool Exists( Predicate&& predicate ) const noexcept
+        {
+            return std::find_if( this->begin(), this->end(), predicate ) != this->end();
+        }
+
+        /// <summary>
+        /// Determines whether the Vector contains elements that match the conditions defined by the specified predicate, using the specified execution policy.
+        /// The search stops in all chunks as soon as any of them finds a match
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should search the Vector</param>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for. It is called concurrently from several threads</param>
+        /// <returns>true if the Vector contains one or more elements that match the conditions defined by the specified predicate; false otherwise</returns>
+        template<class Policy, class Predicate, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const bool Exists( Policy&& policy, Predicate&& predicate ) const
+        {
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if( context == nullptr )
+                return Exists( predicate );
+            return ParallelFindFirstGenericImplementation( *context, predicate, true ) != this->size();
+        }
+#pragma endregion
+
+#pragma region CopyTo
+        /// <summary>
+        /// Copies a range of elements from the Vector to a compatible one-dimensional array starting at the specified index of the target
+        /// </summary>
+        /// <param name="index">The zero-based index in the source Vector at which copying begins</param>
+        /// <param name="array">The one-dimensional array that is the destination of the elements copied from from Vector. The array must have zero-based indexing</param>
+        /// <param name="arrayIndex">The zero-based index in array at which copying begins</param>
+        /// <param name="count">The number of elements to copy</param>
+        void CopyTo( const unsigned int index, T* array, const unsigned int arrayIndex, const unsigned int count ) const
+        {
+            if( array == nullptr )
+                throw std::invalid_argument( "array is nullptr" );
+            else if( index >= this->size() || (this->size() - index) > (count - arrayIndex) )
+                throw std::out_of_range( "index exceeds the size of Vector" );
+            std::copy_n( this->cbegin() + index, count, array + arrayIndex );
+        }
+
+        /// <summary>
+        /// Copies the entire Vector to a compatible one-dimensional array, starting at the beginning of the target array
+        /// </summary>
+        /// <param name="array">The one-dimensional array that is the destination of the elements copied from Vector</param>
+        /// <param name="size">Size of target array which the Vector's elements are copied to</param>
+        void CopyTo( T* array, const unsigned int size ) const
+        {
+            if( array == nullptr )
+                throw std::invalid_argument( "array is nullptr" );
+            else if( size < this->size() )
+                throw std::invalid_argument( "destination smaller than source" );
+            std::copy( this->cbegin(), this->cend(), array );
+        }
+
+        /// <summary>
+        /// Copies the entire Vector to a compatible one-dimensional array, starting at the specified index of the target array
+        /// </summary>
+        /// <param name="array">The one-dimensional array that is the destination of the elements copied from Vector</param>
+        /// <param name="size">Size of target array which the Vector's elements are copied to</param>
+        /// <param name="arrayIndex">The zero-based index in the array at which copying begins</param>
+        void CopyTo( T* array, const unsigned int size, unsigned int arrayIndex ) const
+        {
+            if( array == nullptr )
+                throw std::invalid_argument( "array is nullptr" );
+            else if( size - arrayIndex < this->size() )
+                throw std::invalid_argument( "destination smaller than source" );
+            std::copy( this->cbegin(), this->cend(), array + arrayIndex );
+        }
+
+        /// <summary>
+        /// Copies a range of elements from the Vector to a compatible one-dimensional array starting at the specified index of the target
+        /// </summary>
+        /// <param name="index">The zero-based index in the source Vector at which copying begins</param>
+        /// <param name="array">The destination std::vector where the elements are copied to from Vector.</param>
+        /// <param name="arrayIndex">The zero-based index in array at which copying begins</param>
+        /// <param name="count">The number of elements to copy</param>
+        template<class ArrayAllocator>
+        void CopyTo( const unsigned int index, std::vector<T, ArrayAllocator>& array, const unsigned int arrayIndex, const unsigned int count ) const
+        {
+            if( index >= this->size() || arrayIndex >= array.size() || count > this->size() - index )
+                throw std::out_of_range( "index exceeds the size of Vector" );
+            CopyToGenericImplementation( index, array, arrayIndex, count );
+        }
+
+        /// <summary>
+        /// Copies the entire Vector to a compatible std::vector, starting at the beginning of the target array
+        /// </summary>
+        /// <param name="array">The std::vector that is the destination of the elements copied from Vector</param>
+        template<class ArrayAllocator>
+        void CopyTo( std::vector<T, ArrayAllocator>& array ) const
+        {
+            CopyToGenericImplementation( 0, array, 0, this->size() );
+        }
+
+        /// <summary>
+        /// Copies the entire Vector to a compatible std::vector, starting at the specified index of the target array
+        /// </summary>
+        /// <param name="array">The std::vector that is the destination of the elements copied from Vector</param>
+        /// <param name="arrayIndex">The zero-based index in the array at which copying begins</param>
+        template<class ArrayAllocator>
+        void CopyTo( std::vector<T, ArrayAllocator>& array, unsigned int arrayIndex ) const
+        {
+            if( arrayIndex > array.size() )
+                throw std::out_of_range( "index exceeds the size of destination" );
+            CopyToGenericImplementation( 0, array, arrayIndex, this->size() );
+        }
+
+        /// <summary>
+        /// Copies a range of elements from the Vector to a compatible one-dimensional array starting at the specified index of the target
+        /// </summary>
+        /// <param name="index">The zero-based index in the source Vector at which copying begins</param>
+        /// <param name="array">The destination std::array where the elements are copied to from Vector.</param>
+        /// <param name="arrayIndex">The zero-based index in array at which copying begins</param>
+        /// <param name="count">The number of elements to copy</param>
+        template<std::size_t size>
+        void CopyTo( const unsigned int index, std::array<T, size>& array, const unsigned int arrayIndex, const unsigned int count ) const
+        {
+            if( index >= this->size() || arrayIndex >= array.size() )
+                throw std::out_of_range( "index exceeds the size of Vector" );
+            std::copy_n( this->cbegin() + index, count, array.begin() + arrayIndex );
+        }
+
+        /// <summary>
+        /// Copies the entire Vector to a compatible std::array, starting at the beginning of the target array
+        /// </summary>
+        /// <param name="array">The std::array that is the destination of the elements copied from Vector</param>
+        template<std::size_t size>
+        void CopyTo( std::array<T, size>& array ) const
+        {
+            std::copy( this->cbegin(), this->cend(), array.begin() );
+        }
+
+        /// <summary>
+        /// Copies the entire Vector to a compatible std::array, starting at the specified index of the target array
+        /// </summary>
+        /// <param name="array">The std::array that is the destination of the elements copied from Vector</param>
+        /// <param name="arrayIndex">The zero-based index in the array at which copying begins</param>
+        template<std::size_t size>
+        void CopyTo( std::array<T, size>& array, unsigned int arrayIndex ) const
+        {
+            std::copy( this->cbegin(), this->cend(), array.begin() + arrayIndex );
+        }
+#pragma endregion
+
+#pragma region Find
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate, and returns the first occurrence within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
+        /// <returns>The first element that matches the conditions defined by the specified predicate if found; default T value otherwise</returns>
+        T Find( std::function<bool( const T& )> predicate )
+        {
+            if( predicate == nullptr )
+                throw std::invalid_argument( "predicate is nullptr" );
+            return Find<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate, and returns the first occurrence within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <returns>The first element that matches the conditions defined by the specified predicate if found; default T value otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        T Find( Predicate&& predicate )
+        {
+            for( auto it = this->begin(); it != this->end(); ++it )
+                if( predicate( *it ) == true )
+                    return it.operator*();
+            return T();
+        }
+#pragma endregion
+
+#pragma region RemoveAll
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The std::function delegate that defines the conditions of the elements to remove</param>
+        /// <returns></returns>
+        void RemoveAll( std::function<bool( const T& )> predicate ) noexcept
+        {
+            RemoveAll<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to remove, invoked directly so that it can be inlined</param>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        void RemoveAll( Predicate&& predicate ) noexcept
+        {
+            this->erase( std::remove_if( this->begin(), this->end(), predicate ), this->end() );
+        }
+
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate using the specified execution policy, keeping the order of the remaining elements.
+        /// The predicate is evaluated for all chunks in parallel into a mask, the prefix sums of the per-chunk survivor counts give each chunk the final position of its survivors,
+        /// and the chunks move their survivors through a temporary buffer to those positions in parallel.
+        /// Element types whose moves may throw are processed sequentially
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should process the Vector</param>
+        /// <param name="predicate">The callable that defines the conditions of the elements to remove. It is called concurrently from several threads</param>
+        template<class Policy, class Predicate, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        void RemoveAll( Policy&& policy, Predicate&& predicate )
+        {
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if constexpr( !std::is_nothrow_move_constructible_v<T> || !std::is_nothrow_move_assignable_v<T> )
+                context = nullptr;
+            if( context == nullptr )
+            {
+                this->erase( std::remove_if( this->begin(), this->end(), predicate ), this->end() );
+                return;
+            }
+            const auto bounds = ParallelChunkBounds( *context );
+            std::vector<unsigned char> keep( this->size() );
+            std::vector<std::size_t> offsets( bounds.size(), 0 );
+            auto mark = [&]( const std::size_t begin, const std::size_t end, const std::size_t chunk )
+            {
+                std::size_t survivors = 0;
+                for( std::size_t index = begin; index < end; ++index )
+                {
+                    const bool kept = !predicate( this->operator[]( index ) );
+                    keep[index] = kept;
+                    survivors += kept ? 1 : 0;
+                }
+                offsets[chunk + 1] = survivors;
+            };
+            ParallelForEachChunk( *context, bounds, mark );
+            for( std::size_t chunk = 1; chunk < offsets.size(); ++chunk )
+                offsets[chunk] += offsets[chunk - 1];
+            const std::size_t survivors = offsets.back();
+            if( survivors == this->size() )
+                return;
+
+            Allocator allocator = this->get_allocator();
+            T* const buffer = std::allocator_traits<Allocator>::allocate( allocator, std::max<std::size_t>( survivors, 1 ) );
+            auto gather = [&]( const std::size_t begin, const std::size_t end, const std::size_t chunk )
+            {
+                T* destination = buffer + offsets[chunk];
+                for( std::size_t index = begin; index < end; ++index )
+                    if( keep[index] )
+                        ::new( static_cast<void*>(destination++) ) T( std::move( this->operator[]( index ) ) );
+            };
+            ParallelForEachChunkNoThrow( *context, bounds, gather );
+            auto scatter = [&]( const std::size_t, const std::size_t, const std::size_t chunk )
+            {
+                for( std::size_t position = offsets[chunk]; position < offsets[chunk + 1]; ++position )
+                {
+                    this->operator[]( position ) = std::move( buffer[position] );
+                    buffer[position].~T();
+                }
+            };
+            ParallelForEachChunkNoThrow( *context, bounds, scatter );
+            std::allocator_traits<Allocator>::deallocate( allocator, buffer, std::max<std::size_t>( survivors, 1 ) );
+            this->erase( this->begin() + survivors, this->end() );
+        }
+#pragma endregion
+
+#pragma region RemoveAllOf
+        /// <summary>
+        /// Removes all the elements that are equal to any of the specified values, keeping the order of the remaining elements.
+        /// The values are collected into a temporary hash set once, so the Vector is compacted in a single pass instead of being searched once for every value
+        /// </summary>
+        /// <param name="values">The range of the values to remove from the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Range, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, EnableIfRange<Range, void> = 0>
+        void RemoveAllOf( const Range& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            RemoveByMembershipGenericImplementation( values, hash, equal, true );
+        }
+
+        /// <summary>
+        /// Removes all the elements that are equal to any of the specified values, keeping the order of the remaining elements
+        /// </summary>
+        /// <param name="values">The values to remove from the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>>
+        void RemoveAllOf( const std::initializer_list<T>& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            RemoveByMembershipGenericImplementation( values, hash, equal, true );
+        }
+
+        /// <summary>
+        /// Removes all the elements that are not equal to any of the specified values, keeping the order of the remaining elements.
+        /// The values are collected into a temporary hash set once, so the Vector is compacted in a single pass
+        /// </summary>
+        /// <param name="values">The range of the values to keep in the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Range, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, EnableIfRange<Range, void> = 0>
+        void RetainAllOf( const Range& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            RemoveByMembershipGenericImplementation( values, hash, equal, false );
+        }
+
+        /// <summary>
+        /// Removes all the elements that are not equal to any of the specified values, keeping the order of the remaining elements
+        /// </summary>
+        /// <param name="values">The values to keep in the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>>
+        void RetainAllOf( const std::initializer_list<T>& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            RemoveByMembershipGenericImplementation( values, hash, equal, false );
+        }
+#pragma endregion
+
+#pragma region TrueForAll
+        /// <summary>
+        /// Determines whether every element in the Vector matches the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The std::function delegate that defines the conditions to check whether all elements meets the criteria</param>
+        /// <returns>true if every element in the Vector matches the conditions defined by the predicate; false otherwise</returns>
+        const bool TrueForAll( std::function<bool( const T& )> predicate )
+        {
+            if( predicate == nullptr )
+                throw std::invalid_argument( "predicate is null" );
+            return TrueForAll<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Determines whether every element in the Vector matches the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions to check whether all elements meets the criteria, invoked directly so that it can be inlined</param>
+        /// <returns>true if every element in the Vector matches the conditions defined by the predicate; false otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const bool TrueForAll( Predicate&& predicate )
+        {
+            for( auto it = this->cbegin(); it != this->cend(); ++it )
+                if( predicate( *it ) == false )
+                    return false;
+            return true;
+        }
+
+        /// <summary>
+        /// Determines whether every element in the Vector matches the conditions defined by the specified predicate, using the specified execution policy.
+        /// The check stops in all chunks as soon as any of them finds an element which does not match
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should check the Vector</param>
+        /// <param name="predicate">The callable that defines the conditions to check whether all elements meets the criteria. It is called concurrently from several threads</param>
+        /// <returns>true if every element in the Vector matches the conditions defined by the predicate; false otherwise</returns>
+        template<class Policy, class Predicate, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const bool TrueForAll( Policy&& policy, Predicate&& predicate ) const
+        {
+            auto isMismatch = [&predicate]( const T& element )->bool { return !predicate( element ); };
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if( context == nullptr )
+                return std::find_if( this->cbegin(), this->cend(), isMismatch ) == this->cend();
+            return ParallelFindFirstGenericImplementation( *context, isMismatch, true ) == this->size();
+        }
+#pragma endregion
+
+#pragma region BinarySearch
+        /// <summary>
+        /// Searches the entire sorted Vector for an element using the default comparer and returns the zero-based index of the element
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <returns>The zero-based index of the first occurrence of item in the sorted Vector if item is found; otherwise a negative number that is the bitwise complement of the index of the first element larger than item or of size() if there is no larger element</returns>
+        const int BinarySearch( const T& item ) const noexcept
+        {
+            return BinarySearchGenericImplementation( 0, this->size(),
+                [&]( const T& element )->bool { return element < item; },
+                [&]( const T& element )->bool { return !(item < element); } );
+        }
+
+        /// <summary>
+        /// Searches the entire sorted Vector for an element using the specified comparer and returns the zero-based index of the element
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <param name="comparer">Callable returning true if its first argument precedes the second one in the order of the Vector</param>
+        /// <returns>The zero-based index of the first occurrence of item in the sorted Vector if item is found; otherwise a negative number that is the bitwise complement of the index of the first element larger than item or of size() if there is no larger element</returns>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        const int BinarySearch( const T& item, Comparer&& comparer ) const
+        {
+            return BinarySearch( 0, this->size(), item, comparer );
+        }
+
+        /// <summary>
+        /// Searches a range of elements in the sorted Vector for an element using the specified comparer and returns the zero-based index of the element
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the range to search</param>
+        /// <param name="count">The length of the range to search</param>
+        /// <param name="item">The object to locate</param>
+        /// <param name="comparer">Callable returning true if its first argument precedes the second one in the order of the Vector</param>
+        /// <returns>The zero-based index of the first occurrence of item in the sorted Vector if item is found; otherwise a negative number that is the bitwise complement of the index of the first element larger than item or of start + count if there is no larger element</returns>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        const int BinarySearch( const unsigned int start, const unsigned int count, const T& item, Comparer&& comparer ) const
+        {
+            if( start + count > this->size() )
+                throw std::invalid_argument( "search range exceeds containers size" );
+            return BinarySearchGenericImplementation( start, count,
+                [&]( const T& element )->bool { return comparer( element, item ); },
+                [&]( const T& element )->bool { return !comparer( item, element ); } );
+        }
+
+        /// <summary>
+        /// Searches the entire Vector, sorted by the key returned by projection, for an element with the specified key
+        /// </summary>
+        /// <param name="key">The key to locate</param>
+        /// <param name="projection">Callable returning the key of an element</param>
+        /// <returns>The zero-based index of the first element with the key if found; otherwise a negative number that is the bitwise complement of the index of the first element with a larger key or of size() if there is no such element</returns>
+        template<class Key, class Projection, std::enable_if_t<std::is_invocable_v<Projection&, const T&>, int> = 0>
+        const int BinarySearchByKey( const Key& key, Projection&& projection ) const
+        {
+            return BinarySearchGenericImplementation( 0, this->size(),
+                [&]( const T& element )->bool { return projection( element ) < key; },
+                [&]( const T& element )->bool { return !(key < projection( element )); } );
+        }
+
+        /// <summary>
+        /// Searches the entire sorted Vector for an element using the default comparer and the specified predicate to recognize the element
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <param name="predicate">The std::function predicate which determines whether the first element not smaller than item is the one searched for</param>
+        /// <returns>The zero-based index of item in the sorted Vector if item is found; otherwise a negative number that is the bitwise complement of the index at which item would be inserted</returns>
+        const int BinarySearch( const T& item, std::function<bool( const T& )> predicate ) const
+        {
+            return BinarySearch( item, 0, this->size(), predicate );
+        }
+
+        /// <summary>
+        /// Searches a range of elements in the sorted Vector for an element using the default comparer and the specified predicate to recognize the element
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <param name="start">The zero-based starting index of the range to search</param>
+        /// <param name="count">The length of the range to search</param>
+        /// <param name="predicate">The std::function predicate which determines whether the first element not smaller than item is the one searched for</param>
+        /// <returns>The zero-based index of item in the sorted Vector if item is found; otherwise a negative number that is the bitwise complement of the index at which item would be inserted</returns>
+        const int BinarySearch( const T& item, const unsigned int start, const unsigned int count, std::function<bool( const T& )> predicate ) const
+        {
+            if( start + count > this->size() )
+                throw std::invalid_argument( "search range exceeds containers size" );
+            return BinarySearchGenericImplementation( start, count,
+                [&]( const T& element )->bool { return element < item; },
+                predicate );
+        }
+#pragma endregion
+
+#pragma region Remove
+        /// <summary>
+        /// Removes the first occurrence of a specific object from the Vector
+        /// </summary>
+        /// <param name="item">The object to remove from the Vector</param>
+        /// <returns></returns>
+        void Remove( const T& item ) noexcept
+        {
+            auto it = std::find( this->cbegin(), this->cend(), item );
+            if( it != this->cend() )
+                this->erase( it );
+        }
+#pragma endregion
+
+#pragma region FindLast
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate, and returns the last occurrence within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
+        /// <returns>The last element that matches the conditions defined by the specified predicate if found; default T() otherwise</returns>
+        T FindLast( std::function<bool( const T& )> predicate ) const noexcept
+        {
+            return FindLast<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate, and returns the last occurrence within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <returns>The last element that matches the conditions defined by the specified predicate if found; default T() otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        T FindLast( Predicate&& predicate ) const noexcept
+        {
+            for( auto it = this->crbegin(); it != this->crend(); ++it )
+                if( predicate( *it ) )
+                    return *it;
+            return T();
+        }
+#pragma endregion
+
+#pragma region RemoveRange
+        /// <summary>
+        /// Removes a range of elements from the Vector
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the range of elements to remove</param>
+        /// <param name="count">The number of elements to remove</param>
+        void RemoveRange( const unsigned int start, const unsigned int count )
+        {
+            if( start + count > this->size() )
+                throw std::invalid_argument( "range exceeds the container size" );
+            this->erase( this->cbegin() + start, this->cbegin() + start + count );
+        }
+
+        /// <summary>
+        /// Removes all the specified ranges of elements from the Vector in one pass, moving every remaining element at most once.
+        /// The ranges may be given in any order and may overlap
+        /// </summary>
+        /// <param name="ranges">Pairs of the zero-based starting index and the number of elements of each range to remove</param>
+        void RemoveRanges( const std::vector<std::pair<std::size_t, std::size_t>>& ranges )
+        {
+            std::vector<std::pair<std::size_t, std::size_t>> merged;
+            merged.reserve( ranges.size() );
+            for( const auto& range : ranges )
+            {
+                if( range.first > this->size() || range.second > this->size() - range.first )
+                    throw std::invalid_argument( "range exceeds the container size" );
+                if( range.second > 0 )
+                    merged.emplace_back( range.first, range.first + range.second );
+            }
+            std::sort( merged.begin(), merged.end() );
+            std::size_t last = 0;
+            for( std::size_t i = 1; i < merged.size(); ++i )
+            {
+                if( merged[i].first <= merged[last].second )
+                    merged[last].second = std::max( merged[last].second, merged[i].second );
+                else
+                    merged[++last] = merged[i];
+            }
+            if( !merged.empty() )
+                merged.resize( last + 1 );
+            RemoveRangesGenericImplementation( merged );
+        }
+#pragma endregion
+
+#pragma region IndexOf
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the first occurrence within the entire Vector
+        /// </summary>
+        /// <param name="element">The object to locate in the Vector</param>
+        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
+        const int IndexOf( const T& element ) const
+        {
+            try
+            {
+                return IndexOfGenericImplementation( element, 0, this->size() );
+            }
+            catch( const std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the first occurrence within the range of elements in the Vector that extends from the specified index to the last element
+        /// </summary>
+        /// <param name="element">The object to locate in the Vector</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
+        const int IndexOf( const T& element, const unsigned int start ) const
+        {
+            try
+            {
+                return IndexOfGenericImplementation( element, start, this->size() - start );
+            }
+            catch( const std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the first occurrence within the range of elements in the Vector that starts at the specified index and contains the specified number of elements
+        /// </summary>
+        /// <param name="element">The object to locate in the specified range within the Vector</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <param name="count">The number of elements in the section to search</param>
+        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
+        const int IndexOf( const T& element, const unsigned int start, const unsigned int count ) const
+        {
+            try
+            {
+                return IndexOfGenericImplementation( element, start, count );
+            }
+            catch( const std::invalid_argument& e ) { throw e; }
+        }
+#pragma endregion
+
+#pragma region FindIndex
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The std::function predicate that defines the conditions of the element to search for</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        const int FindIndex( std::function<bool( const T& )> predicate ) const
+        {
+            try
+            {
+                return FindIndexGenericImplementation( predicate, 0, this->size() );
+            }
+            catch( const std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that extends from the specified index to the last element
+        /// </summary>
+        /// <param name="predicate">The std::function predicate that defines the conditions of the element to search for</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        const int FindIndex( std::function<bool( const T& )> predicate, const unsigned int start ) const
+        {
+            try
+            {
+                return FindIndexGenericImplementation( predicate, start, this->size() - start );
+            }
+            catch( const std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that starts at the specified index and contains the specified number of elements
+        /// </summary>
+        /// <param name="predicate">The std::function predicate that defines the conditions of the element to search for</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <param name="count">The number of elements in the section to search</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        const int FindIndex( std::function<bool( const T& )> predicate, const unsigned int start, const unsigned int count ) const
+        {
+            try
+            {
+                return FindIndexGenericImplementation( predicate, start, count );
+            }
+            catch( const std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindIndex( Predicate&& predicate ) const
+        {
+            return FindIndexGenericImplementation( predicate, 0, this->size() );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that extends from the specified index to the last element
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindIndex( Predicate&& predicate, const unsigned int start ) const
+        {
+            return FindIndexGenericImplementation( predicate, start, this->size() - start );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that starts at the specified index and contains the specified number of elements
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <param name="count">The number of elements in the section to search</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindIndex( Predicate&& predicate, const unsigned int start, const unsigned int count ) const
+        {
+            return FindIndexGenericImplementation( predicate, start, count );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector using the specified execution policy.
+        /// Once a match is found, the chunks after it stop searching while the chunks before it continue to look for an earlier one
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should search the Vector</param>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for. It is called concurrently from several threads</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate if found; -1 otherwise</returns>
+        template<class Policy, class Predicate, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindIndex( Policy&& policy, Predicate&& predicate ) const
+        {
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if( context == nullptr )
+                return FindIndex( predicate );
+            const auto index = ParallelFindFirstGenericImplementation( *context, predicate, false );
+            return index != this->size() ? static_cast<int>(index) : -1;
+        }
+#pragma endregion
+
+#pragma region Reverse
+        /// <summary>
+        /// Reverses the order of the elements in the entire Vector
+        /// </summary>
+        /// <returns></returns>
+        void Reverse() noexcept
+        {
+            const auto swapRange = static_cast<int>(this->size() / 2);
+            for( auto swappedIndex = 0; swappedIndex < swapRange; ++swappedIndex )
+                std::swap( this->operator[]( swappedIndex ), this->operator[]( this->size() - 1 - swappedIndex ) );
+        }
+
+        /// <summary>
+        /// Reverses the order of the elements in the specified range within the Vector
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the range to reverse</param>
+        /// <param name="count">The number of elements in the range to reverse</param>
+        void Reverse( const unsigned int start, const unsigned int count )
+        {
+            if( start + count >= this->size() )
+                throw std::invalid_argument( "reverse range exceeds container size" );
+            for( unsigned int swappedIndex = 0; swappedIndex < count / 2; ++swappedIndex )
+                std::swap( this->operator[]( swappedIndex + start ), this->operator[]( start + count - swappedIndex - 1 ) );
+        }
+#pragma endregion
+
+#pragma region FindLastIndex
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
+        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
+        const int FindLastIndex( std::function<bool( const T& )> predicate ) const noexcept
+        {
+            return FindLastIndex<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the entire Vector
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindLastIndex( Predicate&& predicate ) const noexcept
+        {
+            return FindLastIndexGenericImplementation( predicate, 0, static_cast<unsigned int>(this->size()) );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that extends from the first element to the specified index
+        /// </summary>
+        /// <param name="end">The zero-based starting index of the backward search</param>
+        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
+        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
+        const int FindLastIndex( const unsigned int end, std::function<bool( const T& )> predicate ) const
+        {
+            return FindLastIndex<std::function<bool( const T& )>&>( end, predicate );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that extends from the first element to the specified index
+        /// </summary>
+        /// <param name="end">The zero-based starting index of the backward search</param>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <returns>The zero-based index of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindLastIndex( const unsigned int end, Predicate&& predicate ) const
+        {
+            if( end >= this->size() )
+                throw std::invalid_argument( "Ending index exceeds container size" );
+            return FindLastIndexGenericImplementation( predicate, 0, end );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that contains the specified number of elements and ends at the specified index
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the backward search</param>
+        /// <param name="end">The zero-based ending index of the backward search</param>
+        /// <param name="predicate">The std::function delegate that defines the conditions of the element to search for</param>
+        /// <returns>The zero-based index, counted from the beginning of the Vector, of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
+        const int FindLastIndex( const unsigned int start, const unsigned int end, std::function<bool( const T& )> predicate ) const
+        {
+            return FindLastIndex<std::function<bool( const T& )>&>( start, end, predicate );
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate within the range of elements in the Vector that contains the specified number of elements and ends at the specified index
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the backward search</param>
+        /// <param name="end">The zero-based ending index of the backward search</param>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked directly so that it can be inlined</param>
+        /// <returns>The zero-based index, counted from the beginning of the Vector, of the last occurrence of an element that matches the conditions if found; -1 otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        const int FindLastIndex( const unsigned int start, const unsigned int end, Predicate&& predicate ) const
+        {
+            if( start > end )
+                throw std::invalid_argument( "starting index bigger than ending index of search range" );
+            else if( end >= this->size() )
+                throw std::invalid_argument( "ending index exceeds container size" );
+            else if( start >= this->size() )
+                throw std::invalid_argument( "starting index is beyond the container size" );
+            return FindLastIndexGenericImplementation( predicate, start, end );
+        }
+#pragma endregion
+
+#pragma region InsertRange
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">The collection given as pointer to buffer whose elements should be insterted into the Vector</param>
+        /// <param name="n">Number of elements in the collection</param>
+        void InsertRange( const unsigned int index, const T* const range, const unsigned int n )
+        {
+            if( range == nullptr )
+                throw std::invalid_argument( "range is nullptr" );
+            else if( index > this->size() )
+                throw std::invalid_argument( "insertion index beyond container size" );
+            const std::less<const T*> precedes;
+            if( !precedes( range, this->data() ) && precedes( range, this->data() + this->size() ) )
+            {
+                const std::vector<T, Allocator> copy( range, range + n, this->get_allocator() );
+                this->insert( this->cbegin() + index, copy.begin(), copy.end() );
+            }
+            else
+                this->insert( this->cbegin() + index, range, range + n );
+        }
+
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
+        void InsertRange( const unsigned int index, const std::vector<T, Allocator>& range )
+        {
+            try
+            {
+                InsertRange( index, range.data(), range.size() );
+            }
+            catch( std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
+        void InsertRange( const unsigned int index, std::vector<T, Allocator>&& range )
+        {
+            InsertRange( index, std::make_move_iterator( range.begin() ), std::make_move_iterator( range.end() ) );
+        }
+
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
+        void InsertRange( const unsigned int index, const Vector<T, Allocator>& range )
+        {
+            try
+            {
+                InsertRange( index, range.data(), range.size() );
+            }
+            catch( std::invalid_argument& e ) { throw e; }
+        }
+
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
+        void InsertRange( const unsigned int index, Vector<T, Allocator>&& range )
+        {
+            InsertRange( index, std::make_move_iterator( range.begin() ), std::make_move_iterator( range.end() ) );
+        }
+
+        /// <summary>
+        /// Inserts the elements of the range given as iterator pair into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="first">Iterator to the first element which should be inserted</param>
+        /// <param name="last">Iterator past the last element which should be inserted</param>
+        template<class InputIterator, EnableIfIterator<InputIterator> = 0>
+        void InsertRange( const unsigned int index, InputIterator first, InputIterator last )
+        {
+            if( index > this->size() )
+                throw std::invalid_argument( "insertion index beyond container size" );
+            this->insert( this->cbegin() + index, first, last );
+        }
+
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">Any collection traversable with std::begin and std::end. Elements of an rvalue collection are moved</param>
+        template<class Range, EnableIfRange<Range, Vector<T, Allocator>> = 0>
+        void InsertRange( const unsigned int index, Range&& range )
+        {
+            if( index > this->size() )
+                throw std::invalid_argument( "insertion index beyond container size" );
+            ReserveForRange( range );
+            if constexpr( std::is_rvalue_reference_v<Range&&> )
+                InsertRange( index, std::make_move_iterator( std::begin( range ) ), std::make_move_iterator( std::end( range ) ) );
+            else
+                InsertRange( index, std::begin( range ), std::end( range ) );
+        }
+#pragma endregion
 
 #pragma region GetRange
         /// <summary>
-        /// Creates a shallow copy of a range of elements in the source Vector
+        /// Creates a shallow copy of a range of elements in the source Vector
+        /// </summary>
+        /// <param name="start">The zero-based index in Vector at which the range starts</param>
+        /// <param name="end">The zero-based index in Vector at which the range ends</param>
+        /// <returns>A shallow copy of a range of elements in the source Vector</returns>
+        Vector<T, Allocator> GetRange( const unsigned int start, const unsigned int end ) const
+        {
+            if( start >= this->size() || end >= this->size() || start >= end )
+                throw std::invalid_argument( "Incorrect range tresholds were given" );
+            Vector<T, Allocator> newVector( ResultAllocator() );
+            for( auto it = this->cbegin() + start; it != this->cbegin() + end; ++it )
+                newVector.push_back( *it );
+            return newVector;
+        }
+#pragma endregion
+
+#pragma region LastIndexOf
+        /// <summary>
+        /// Searches for the specified object within the entire Vector
+        /// </summary>
+        /// <param name="item">The object to locate in the Vector. The value is not checked against nullptr</param>
+        /// <returns>The zero-based index of the last occurrence of item within the entire Vector if found; -1 otherwise</returns>
+        const int LastIndexOf( const T& item ) const noexcept
+        {
+            return LastIndexOfGenericImplementation( item, 0, this->size() );
+        }
+
+        /// <summary>
+        /// Searches for the specified object within the range of elements in the Vector. The range starts at position index and ends at the last element of Vector
+        /// </summary>
+        /// <param name="item">The object to locate in the Vector. The value is not checked against nullpts</param>
+        /// <param name="index">The zero-based starting index of the range to search</param>
+        /// <returns>The zero-based index of the last occurrence of item within the range of elements in the Vector</returns>
+        const int LastIndexOf( const T& item, const unsigned int index )
+        {
+            return LastIndexOfGenericImplementation( item, 0, index );
+        }
+
+        /// <summary>
+        /// Searches for the specified object within the range of elements in the Vector. The range starts at position index and comprises the number of elements given as count parameter.
+        /// </summary>
+        /// <param name="item">The object to locate in the Vector</param>
+        /// <param name="index">The zero-based starting index of the search</param>
+        /// <param name="count">The number of elements in the search range</param>
+        /// <returns>The zero-based index, counted from the beginning of the Vector, of the last occurrence within the specified range of elements if found; -1 otherwise</returns>
+        const int LastIndexOf( const T& item, const unsigned int index, const unsigned int count )
+        {
+            return LastIndexOfGenericImplementation( item, index, count );
+        }
+#pragma endregion
+
+#pragma region ConvertAll
+        /// <summary>
+        /// Converts the elements in the current Vector to another type and returns a Vector containing the converted elements
+        /// </summary>
+        /// <typeparam name="Tout">The type of the elements of the target array</typeparam>
+        /// <param name="converter">A std::function delegate that converts each element from one type to another type</param>
+        /// <returns>A Vector of the target type containing the converted elements from the current Vector</returns>
+        template<class Tout> RebindVector<Tout> ConvertAll( std::function<Tout( const T& )> converter ) const noexcept
+        {
+            return ConvertAll<Tout, std::function<Tout( const T& )>&>( converter );
+        }
+
+        /// <summary>
+        /// Converts the elements in the current Vector to another type and returns a Vector containing the converted elements
+        /// </summary>
+        /// <typeparam name="Tout">The type of the elements of the target array</typeparam>
+        /// <param name="converter">A callable that converts each element from one type to another type, invoked directly so that it can be inlined</param>
+        /// <returns>A Vector of the target type containing the converted elements from the current Vector</returns>
+        template<class Tout, class Converter, EnableIfInvocable<Tout, Converter, const T&> = 0>
+        RebindVector<Tout> ConvertAll( Converter&& converter ) const noexcept
+        {
+            RebindVector<Tout> convertedContainer{ typename RebindVector<Tout>::allocator_type( ResultAllocator() ) };
+            for( auto it = this->cbegin(); it != this->cend(); ++it )
+                convertedContainer.push_back( converter( *it ) );
+            return convertedContainer;
+        }
+
+        /// <summary>
+        /// Converts the elements in the current Vector to another type using the specified execution policy and returns a Vector containing the converted elements in the same order.
+        /// The conversion runs in parallel if Tout is default constructible and move assignable; otherwise it runs sequentially
+        /// </summary>
+        /// <typeparam name="Tout">The type of the elements of the target array</typeparam>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should convert the elements</param>
+        /// <param name="converter">A callable that converts each element from one type to another type. It is called concurrently from several threads</param>
+        /// <returns>A Vector of the target type containing the converted elements from the current Vector</returns>
+        template<class Tout, class Policy, class Converter, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<Tout, Converter, const T&> = 0>
+        RebindVector<Tout> ConvertAll( Policy&& policy, Converter&& converter ) const
+        {
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if constexpr( std::is_default_constructible_v<Tout> && std::is_move_assignable_v<Tout> && !std::is_same_v<Tout, bool> )
+            {
+                if( context != nullptr )
+                {
+                    RebindVector<Tout> convertedContainer{ typename RebindVector<Tout>::allocator_type( ResultAllocator() ) };
+                    convertedContainer.resize( this->size() );
+                    auto convert = [&]( const std::size_t begin, const std::size_t end, const std::size_t )
+                    {
+                        for( std::size_t index = begin; index < end; ++index )
+                            convertedContainer[index] = converter( this->operator[]( index ) );
+                    };
+                    ParallelForEachChunk( *context, ParallelChunkBounds( *context ), convert );
+                    return convertedContainer;
+                }
+            }
+            return ConvertAll<Tout>( converter );
+        }
+#pragma endregion
+
+#pragma region Query
+        /// <summary>
+        /// Creates a lazy query over the elements of the Vector. Its Where, Select, Take and Skip stages run fused in a single loop, without intermediate Vectors,
+        /// only when a terminal operation such as ToVector, Count, Any, First or Sum is called
+        /// </summary>
+        /// <returns>The query producing constant references to the elements of the Vector, which has to outlive the query</returns>
+        auto Query() const&
+        {
+            auto elements = [source = this]( auto&& consumer )
+            {
+                for( const T& element : *source )
+                    if( !consumer( element ) )
+                        return;
+            };
+            return LazyQuery<const T&, decltype(elements)>( std::move( elements ), this->size() );
+        }
+
+        auto Query() const&& = delete;
+#pragma endregion
+
+#pragma region RemoveAt
+        /// <summary>
+        /// Removes the element at specified index of the Vector
+        /// </summary>
+        /// <param name="index">The zero-based index of the element to remove</param>
+        void RemoveAt( const unsigned int index )
+        {
+            if( index >= this->size() )
+                throw std::invalid_argument( "index to remove exceeds the container size" );
+            this->erase( this->cbegin() + index );
+        }
+
+        /// <summary>
+        /// Removes the elements at all the specified indices of the Vector in one pass, moving every remaining element at most once.
+        /// The indices may be given in any order and may repeat
+        /// </summary>
+        /// <param name="indices">The zero-based indices of the elements to remove</param>
+        void RemoveAt( const std::vector<std::size_t>& indices )
+        {
+            std::vector<std::size_t> sorted( indices );
+            std::sort( sorted.begin(), sorted.end() );
+            sorted.erase( std::unique( sorted.begin(), sorted.end() ), sorted.end() );
+            if( !sorted.empty() && sorted.back() >= this->size() )
+                throw std::invalid_argument( "index to remove exceeds the container size" );
+            std::vector<std::pair<std::size_t, std::size_t>> ranges;
+            for( const auto index : sorted )
+            {
+                if( !ranges.empty() && ranges.back().second == index )
+                    ++ranges.back().second;
+                else
+                    ranges.emplace_back( index, index + 1 );
+            }
+            RemoveRangesGenericImplementation( ranges );
+        }
+#pragma endregion
+
+#pragma region RemoveUnordered
+        /// <summary>
+        /// Removes the element at specified index of the Vector by moving the last element into its place, without preserving the order of the elements
+        /// </summary>
+        /// <param name="index">The zero-based index of the element to remove</param>
+        void RemoveAtSwapBack( const unsigned int index )
+        {
+            if( index >= this->size() )
+                throw std::invalid_argument( "index to remove exceeds the container size" );
+            if( index + 1 != this->size() )
+                this->operator[]( index ) = std::move( this->back() );
+            this->pop_back();
+        }
+
+        /// <summary>
+        /// Removes the first occurrence of a specific object from the Vector by moving the last element into its place, without preserving the order of the elements
+        /// </summary>
+        /// <param name="item">The object to remove from the Vector</param>
+        void RemoveUnordered( const T& item ) noexcept
+        {
+            const int index = IndexOfGenericImplementation( item, 0, this->size() );
+            if( index >= 0 )
+                RemoveAtSwapBack( index );
+        }
+
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate, without preserving the order of the remaining elements.
+        /// Each removed element is replaced by the last remaining element of the Vector, so only as many elements are moved as are removed from before the new end
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to remove, invoked once for each element</param>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        void RemoveAllUnordered( Predicate&& predicate )
+        {
+            std::size_t first = 0;
+            std::size_t last = this->size();
+            while( true )
+            {
+                while( first < last && !predicate( this->operator[]( first ) ) )
+                    ++first;
+                if( first == last )
+                    break;
+                do
+                    --last;
+                while( last > first && predicate( this->operator[]( last ) ) );
+                if( last == first )
+                    break;
+                this->operator[]( first++ ) = std::move( this->operator[]( last ) );
+            }
+            this->erase( this->begin() + first, this->end() );
+        }
+#pragma endregion
+
+#pragma region ForEach
+        /// <summary>
+        /// Performes the specified action on each element of the Vector
+        /// </summary>
+        /// <param name="action">The std::function delegate to perform on each element of the Vector</param>
+        /// <returns></returns>
+        void ForEach( std::function<void( T& )> action ) noexcept
+        {
+            ForEach<std::function<void( T& )>&>( action );
+        }
+
+        /// <summary>
+        /// Performes the specified action on each element of the Vector
+        /// </summary>
+        /// <param name="action">The callable to perform on each element of the Vector, invoked directly so that it can be inlined</param>
+        template<class Action, EnableIfInvocable<void, Action, T&> = 0>
+        void ForEach( Action&& action ) noexcept
+        {
+            for( T& element : *this )
+                action( element );
+        }
+
+        /// <summary>
+        /// Performes the specified action on each element of the Vector using the specified execution policy
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should perform the action</param>
+        /// <param name="action">The callable to perform on each element of the Vector. It is called concurrently from several threads, each time for a different element</param>
+        template<class Policy, class Action, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<void, Action, T&> = 0>
+        void ForEach( Policy&& policy, Action&& action )
+        {
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if( context == nullptr )
+                return ForEach( action );
+            auto perform = [&]( const std::size_t begin, const std::size_t end, const std::size_t )
+            {
+                for( std::size_t index = begin; index < end; ++index )
+                    action( this->operator[]( index ) );
+            };
+            ParallelForEachChunk( *context, ParallelChunkBounds( *context ), perform );
+        }
+#pragma endregion
+
+#pragma region FindAll
+        /// <summary>
+        /// Retrieve all the elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The std::function predicate that defines the conditions of the elements to search for</param>
+        /// <returns>A Vector containing all the elements that match the conditions defined by the specified predicate if any is found; empty Vector otherwise</returns>
+        Vector<T, Allocator> FindAll( std::function<bool( const T& )> predicate ) const noexcept
+        {
+            return FindAll<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Retrieve all the elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for, invoked directly so that it can be inlined</param>
+        /// <returns>A Vector containing all the elements that match the conditions defined by the specified predicate if any is found; empty Vector otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        Vector<T, Allocator> FindAll( Predicate&& predicate ) const noexcept
+        {
+            Vector<T, Allocator> results( ResultAllocator() );
+            for( const auto& element : *this )
+                if( predicate( element ) )
+                    results.push_back( element );
+            return results;
+        }
+
+        /// <summary>
+        /// Retrieve all the elements that match the conditions defined by the specified predicate using the specified execution policy.
+        /// Every chunk collects the positions of its matches, and their prefix sums give each chunk the place of its matches in the result, so the elements keep their order
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should search the Vector</param>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for. It is called concurrently from several threads</param>
+        /// <returns>A Vector containing all the elements that match the conditions defined by the specified predicate if any is found; empty Vector otherwise</returns>
+        template<class Policy, class Predicate, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        Vector<T, Allocator> FindAll( Policy&& policy, Predicate&& predicate ) const
+        {
+            auto* context = ParallelContext( ExecutionContext::Select( policy ) );
+            if( context == nullptr )
+                return FindAll( predicate );
+            const auto bounds = ParallelChunkBounds( *context );
+            std::vector<std::vector<std::size_t>> matches( bounds.size() - 1 );
+            auto select = [&]( const std::size_t begin, const std::size_t end, const std::size_t chunk )
+            {
+                for( std::size_t index = begin; index < end; ++index )
+                    if( predicate( this->operator[]( index ) ) )
+                        matches[chunk].push_back( index );
+            };
+            ParallelForEachChunk( *context, bounds, select );
+
+            std::vector<std::size_t> offsets( matches.size() + 1, 0 );
+            for( std::size_t chunk = 0; chunk < matches.size(); ++chunk )
+                offsets[chunk + 1] = offsets[chunk] + matches[chunk].size();
+            Vector<T, Allocator> results( ResultAllocator() );
+            if constexpr( std::is_default_constructible_v<T> && std::is_copy_assignable_v<T> && !std::is_same_v<T, bool> )
+            {
+                results.resize( offsets.back() );
+                auto copy = [&]( const std::size_t, const std::size_t, const std::size_t chunk )
+                {
+                    for( std::size_t match = 0; match < matches[chunk].size(); ++match )
+                        results[offsets[chunk] + match] = this->operator[]( matches[chunk][match] );
+                };
+                ParallelForEachChunk( *context, bounds, copy );
+            }
+            else
+            {
+                results.reserve( offsets.back() );
+                for( const auto& chunkMatches : matches )
+                    for( const auto index : chunkMatches )
+                        results.push_back( this->operator[]( index ) );
+            }
+            return results;
+        }
+#pragma endregion
+
+
+    private:
+        static constexpr std::size_t radixSortThreshold = 1 << 10;
+
+        /// <summary>
+        /// Maps the key to an unsigned integer of the same size whose ascending order is the ascending order of the key
+        /// </summary>
+        template<class Key>
+        static auto RadixKey( const Key key ) noexcept
+        {
+            using Bits = std::conditional_t<sizeof( Key ) == 1, std::uint8_t,
+                std::conditional_t<sizeof( Key ) == 2, std::uint16_t,
+                std::conditional_t<sizeof( Key ) == 4, std::uint32_t, std::uint64_t>>>;
+            constexpr Bits signBit = Bits( 1 ) << (sizeof( Key ) * 8 - 1);
+            if constexpr( std::is_floating_point_v<Key> )
+            {
+                Bits bits;
+                std::memcpy( &bits, &key, sizeof( Key ) );
+                return static_cast<Bits>((bits & signBit) ? ~bits : bits | signBit);
+            }
+            else if constexpr( std::is_signed_v<Key> )
+                return static_cast<Bits>(static_cast<Bits>(key) ^ signBit);
+            else
+                return static_cast<Bits>(key);
+        }
+
+        /// <summary>
+        /// Stable LSD radix sort of items by the unsigned integer returned by radixKey, one byte per pass.
+        /// Passes in which all items share the same byte are skipped
+        /// </summary>
+        template<class Item, class ItemAllocator, class RadixKeyOf>
+        static void RadixSort( std::vector<Item, ItemAllocator>& items, RadixKeyOf radixKey )
+        {
+            using Bits = decltype(radixKey( items.front() ));
+            constexpr std::size_t passes = sizeof( Bits );
+            constexpr std::size_t buckets = 256;
+            if( items.size() < 2 )
+                return;
+
+            std::vector<std::array<std::size_t, buckets>> histograms( passes );
+            for( auto& histogram : histograms )
+                histogram.fill( 0 );
+            for( const auto& item : items )
+            {
+                const Bits bits = radixKey( item );
+                for( std::size_t pass = 0; pass < passes; ++pass )
+                    ++histograms[pass][(bits >> (pass * 8)) & 0xFF];
+            }
+
+            std::vector<Item, ItemAllocator> buffer( items.size(), items.get_allocator() );
+            Item* source = items.data();
+            Item* destination = buffer.data();
+            for( std::size_t pass = 0; pass < passes; ++pass )
+            {
+                auto& histogram = histograms[pass];
+                if( histogram[(radixKey( *source ) >> (pass * 8)) & 0xFF] == items.size() )
+                    continue;
+                std::size_t offset = 0;
+                for( auto& count : histogram )
+                    offset += std::exchange( count, offset );
+                for( std::size_t i = 0; i < items.size(); ++i )
+                    destination[histogram[(radixKey( source[i] ) >> (pass * 8)) & 0xFF]++] = std::move( source[i] );
+                std::swap( source, destination );
+            }
+            if( source != items.data() )
+                std::move( source, source + items.size(), items.data() );
+        }
+
+        /// <summary>
+        /// Sample sort: a regular sample of the elements is sorted to pick one splitter per bucket, every chunk then computes the buckets of its elements in parallel,
+        /// the elements are moved to their buckets through a temporary buffer and the buckets are sorted in parallel. Every phase is split evenly between the threads,
+        /// instead of partitioning the whole Vector on one thread before any parallel work starts. Many elements equal to a splitter all land in one bucket
+        /// </summary>
+        template<class Comparer>
+        void ParallelSortGenericImplementation( ExecutionContext* context, Comparer& comparer )
+        {
+            context = ParallelContext( context );
+            if constexpr( !std::is_nothrow_move_constructible_v<T> || !std::is_nothrow_move_assignable_v<T> )
+                context = nullptr;
+            if( context == nullptr )
+            {
+                std::sort( this->begin(), this->end(), comparer );
+                return;
+            }
+            constexpr std::size_t oversampling = 16;
+            const std::size_t bucketCount = std::min<std::size_t>( std::size_t( context->ThreadCount() ) * 4, std::numeric_limits<std::uint32_t>::max() );
+            const std::size_t sampleCount = std::min( bucketCount * oversampling, this->size() );
+            std::vector<const T*> sample( sampleCount );
+            for( std::size_t i = 0; i < sampleCount; ++i )
+                sample[i] = this->data() + i * this->size() / sampleCount;
+            std::sort( sample.begin(), sample.end(), [&]( const T* left, const T* right ) { return comparer( *left, *right ); } );
+            std::vector<const T*> splitters;
+            for( std::size_t bucket = 1; bucket < bucketCount; ++bucket )
+                splitters.push_back( sample[bucket * sampleCount / bucketCount] );
+
+            const auto bounds = ParallelChunkBounds( *context );
+            const std::size_t chunkCount = bounds.size() - 1;
+            std::vector<std::uint32_t> buckets( this->size() );
+            std::vector<std::size_t> offsets( chunkCount * bucketCount, 0 );
+            auto classify = [&]( const std::size_t begin, const std::size_t end, const std::size_t chunk )
+            {
+                std::size_t* counts = offsets.data() + chunk * bucketCount;
+                for( std::size_t index = begin; index < end; ++index )
+                {
+                    const T& element = this->operator[]( index );
+                    const auto bucket = std::upper_bound( splitters.cbegin(), splitters.cend(), &element,
+                        [&]( const T* left, const T* right ) { return comparer( *left, *right ); } ) - splitters.cbegin();
+                    buckets[index] = static_cast<std::uint32_t>(bucket);
+                    ++counts[bucket];
+                }
+            };
+            ParallelForEachChunk( *context, bounds, classify );
+
+            // Each chunk writes its elements of a bucket after the ones of the previous chunks
+            std::vector<std::size_t> bucketBounds( bucketCount + 1, 0 );
+            std::size_t position = 0;
+            for( std::size_t bucket = 0; bucket < bucketCount; ++bucket )
+            {
+                bucketBounds[bucket] = position;
+                for( std::size_t chunk = 0; chunk < chunkCount; ++chunk )
+                    position += std::exchange( offsets[chunk * bucketCount + bucket], position );
+            }
+            bucketBounds[bucketCount] = position;
+
+            Allocator allocator = this->get_allocator();
+            T* const buffer = std::allocator_traits<Allocator>::allocate( allocator, this->size() );
+            auto distribute = [&]( const std::size_t begin, const std::size_t end, const std::size_t chunk )
+            {
+                std::size_t* destinations = offsets.data() + chunk * bucketCount;
+                for( std::size_t index = begin; index < end; ++index )
+                    ::new( static_cast<void*>(buffer + destinations[buckets[index]]++) ) T( std::move( this->operator[]( index ) ) );
+            };
+            ParallelForEachChunkNoThrow( *context, bounds, distribute );
+            auto gather = [&]( const std::size_t begin, const std::size_t end, const std::size_t )
+            {
+                for( std::size_t index = begin; index < end; ++index )
+                {
+                    this->operator[]( index ) = std::move( buffer[index] );
+                    buffer[index].~T();
+                }
+            };
+            ParallelForEachChunkNoThrow( *context, bucketBounds, gather );
+            std::allocator_traits<Allocator>::deallocate( allocator, buffer, this->size() );
+
+            auto sort = [&]( const std::size_t begin, const std::size_t end, const std::size_t )
+            {
+                std::sort( this->begin() + begin, this->begin() + end, comparer );
+            };
+            ParallelForEachChunk( *context, bucketBounds, sort );
+        }
+
+        /// <summary>
+        /// Returns the context if it has more than one thread and the Vector is larger than its serial threshold; nullptr otherwise
+        /// </summary>
+        ExecutionContext* ParallelContext( ExecutionContext* context ) const noexcept
+        {
+            if( context == nullptr || context->ThreadCount() < 2 || this->size() <= context->SerialThreshold() )
+                return nullptr;
+            return context;
+        }
+
+        /// <summary>
+        /// Splits the Vector into a few chunks per thread. Chunk boundaries fall on cache line boundaries where the element size allows it,
+        /// so that tasks writing to neighbouring chunks do not share cache lines
+        /// </summary>
+        std::vector<std::size_t> ParallelChunkBounds( const ExecutionContext& context ) const
+        {
+            constexpr std::size_t cacheLine = 64;
+            constexpr std::size_t elementsPerLine = std::max<std::size_t>( cacheLine / sizeof( T ), 1 );
+            const std::size_t chunks = std::size_t( context.ThreadCount() ) * 4;
+            const std::size_t chunkSize = ((this->size() + chunks - 1) / chunks + elementsPerLine - 1) / elementsPerLine * elementsPerLine;
+
+            std::vector<std::size_t> bounds{ 0 };
+            std::size_t bound = 0;
+            if( cacheLine % sizeof( T ) == 0 )
+                bound = (cacheLine - reinterpret_cast<std::uintptr_t>(this->data()) % cacheLine) % cacheLine / sizeof( T );
+            if( bound == 0 )
+                bound = chunkSize;
+            for( ; bound < this->size(); bound += chunkSize )
+                bounds.push_back( bound );
+            bounds.push_back( this->size() );
+            return bounds;
+        }
+
+        /// <summary>
+        /// Runs body( begin, end, chunk ) for every chunk on the context and waits for all of them. The calling thread runs chunks as well
+        /// </summary>
+        template<class Body>
+        static void ParallelForEachChunk( ExecutionContext& context, const std::vector<std::size_t>& bounds, Body& body )
+        {
+            TaskGroup group( context );
+            for( std::size_t chunk = 0; chunk + 1 < bounds.size(); ++chunk )
+                group.Run( [&body, &bounds, chunk]() { body( bounds[chunk], bounds[chunk + 1], chunk ); } );
+            group.Wait();
+        }
+
+        /// <summary>
+        /// Runs body( begin, end, chunk ) for every chunk like ParallelForEachChunk, for bodies which cannot throw.
+        /// The chunks which could not be queued, for example because the queue failed to allocate memory, run on the calling thread, so every chunk always runs exactly once
+        /// </summary>
+        template<class Body>
+        static void ParallelForEachChunkNoThrow( ExecutionContext& context, const std::vector<std::size_t>& bounds, Body& body ) noexcept
+        {
+            std::vector<unsigned char> done;
+            try
+            {
+                done.assign( bounds.size() - 1, 0 );
+                auto run = [&body, &done]( const std::size_t begin, const std::size_t end, const std::size_t chunk )
+                {
+                    body( begin, end, chunk );
+                    done[chunk] = 1;
+                };
+                ParallelForEachChunk( context, bounds, run );
+            }
+            catch( ... )
+            {
+                for( std::size_t chunk = 0; chunk + 1 < bounds.size(); ++chunk )
+                    if( done.empty() || !done[chunk] )
+                        body( bounds[chunk], bounds[chunk + 1], chunk );
+            }
+        }
+
+        /// <summary>
+        /// Returns the index of the first element matching the predicate, or the size of the Vector if there is none.
+        /// Every chunk checks once per cache line whether a match has already been found before it (or anywhere, with stopAtAnyMatch) and stops if so
+        /// </summary>
+        template<class Predicate>
+        std::size_t ParallelFindFirstGenericImplementation( ExecutionContext& context, Predicate& predicate, const bool stopAtAnyMatch ) const
+        {
+            constexpr std::size_t checkInterval = std::max<std::size_t>( 64 / sizeof( T ), 1 );
+            const std::size_t notFound = this->size();
+            std::atomic<std::size_t> found{ notFound };
+            auto search = [&]( const std::size_t begin, const std::size_t end, const std::size_t )
+            {
+                for( std::size_t block = begin; block < end; block += checkInterval )
+                {
+                    const auto foundSoFar = found.load( std::memory_order_relaxed );
+                    if( foundSoFar < block || (stopAtAnyMatch && foundSoFar != notFound) )
+                        return;
+                    for( std::size_t index = block; index < std::min( block + checkInterval, end ); ++index )
+                    {
+                        if( predicate( this->operator[]( index ) ) )
+                        {
+                            auto current = found.load( std::memory_order_relaxed );
+                            while( index < current && !found.compare_exchange_weak( current, index, std::memory_order_relaxed ) )
+                            {}
+                            return;
+                        }
+                    }
+                }
+            };
+            ParallelForEachChunk( context, ParallelChunkBounds( context ), search );
+            return found.load();
+        }
+
+        void ValidateSortRange( const unsigned int positionBegin, const unsigned int positionEnd ) const
+        {
+            if( positionEnd >= this->size() )
+                throw std::out_of_range( "ending index exceeds container size" );
+            else if( positionBegin > positionEnd )
+                throw std::out_of_range( "starting index bigger than ending index of sort range" );
+        }
+
+
+        /// <summary>
+        /// Determines whether the buffer of the other Vector can be taken over by swap: the allocators have to be swapped along or be able to free each other's memory
+        /// </summary>
+        bool CanAdoptBufferOf( const Vector<T, Allocator>& other ) const noexcept
+        {
+            using Traits = std::allocator_traits<Allocator>;
+            if constexpr( Traits::propagate_on_container_swap::value || Traits::is_always_equal::value )
+                return true;
+            else
+                return this->get_allocator() == other.get_allocator();
+        }
+
+        /// <summary>
+        /// Selects the allocator of the Vectors returned by FindAll, GetRange and ConvertAll as described by SharesAllocatorWithResults
+        /// </summary>
+        Allocator ResultAllocator() const
+        {
+            if constexpr( SharesAllocatorWithResults<Allocator>::value )
+                return this->get_allocator();
+            else
+                return std::allocator_traits<Allocator>::select_on_container_copy_construction( this->get_allocator() );
+        }
+
+
+        template<class ArrayAllocator>
+        void CopyToGenericImplementation( const std::size_t index, std::vector<T, ArrayAllocator>& array, const std::size_t arrayIndex, const std::size_t count ) const
+        {
+            if( static_cast<const void*>(&array) == static_cast<const void*>(static_cast<const std::vector<T, Allocator>*>(this)) )
+            {
+                const std::vector<T, Allocator> copy( this->cbegin() + index, this->cbegin() + index + count, this->get_allocator() );
+                array.insert( array.cbegin() + arrayIndex, copy.begin(), copy.end() );
+            }
+            else
+                array.insert( array.cbegin() + arrayIndex, this->cbegin() + index, this->cbegin() + index + count );
+        }
+
+
+        template<class Range>
+        void ReserveForRange( Range& range )
+        {
+            using Iterator = decltype(std::begin( range ));
+            using Category = typename std::iterator_traits<Iterator>::iterator_category;
+            if constexpr( IsSizedRange<Range>::value && !std::is_base_of_v<std::forward_iterator_tag, Category> )
+                this->reserve( this->size() + std::size( range ) );
+        }
+
+
+        /// <summary>
+        /// Branchless lower bound over [start, start + count): the loop body has no data-dependent branch,
+        /// so for arithmetic types it compiles to conditional moves, and both possible next probes are prefetched
+        /// </summary>
+        template<class IsBefore, class IsMatch>
+        const int BinarySearchGenericImplementation( const std::size_t start, const std::size_t count, IsBefore&& isBefore, IsMatch&& isMatch ) const
+        {
+            if( count == 0 )
+                return ~static_cast<int>(start);
+            const T* first = this->data() + start;
+            std::size_t length = count;
+            while( length > 1 )
+            {
+                const std::size_t half = length / 2;
+                CacheHint::Prefetch( first + half / 2 );
+                CacheHint::Prefetch( first + half + half / 2 );
+                first = isBefore( first[half] ) ? first + half : first;
+                length -= half;
+            }
+            const auto index = static_cast<std::size_t>(first - this->data()) + (isBefore( *first ) ? 1 : 0);
+            if( index < start + count && isMatch( this->operator[]( index ) ) )
+                return static_cast<int>(index);
+            return ~static_cast<int>(index);
+        }
+
+
+
+        /// <summary>
+        /// Removes the sorted, disjoint and non-adjacent [begin, end) ranges by moving each run of remaining elements directly to its final place
+        /// </summary>
+        void RemoveRangesGenericImplementation( const std::vector<std::pair<std::size_t, std::size_t>>& ranges )
+        {
+            if( ranges.empty() )
+                return;
+            auto destination = this->begin() + ranges.front().first;
+            for( std::size_t i = 0; i < ranges.size(); ++i )
+            {
+                const auto keptEnd = i + 1 < ranges.size() ? this->begin() + ranges[i + 1].first : this->end();
+                destination = std::move( this->begin() + ranges[i].second, keptEnd, destination );
+            }
+            this->erase( destination, this->end() );
+        }
+
+
+        /// <summary>
+        /// Removes the elements whose membership in values equals removeMembers. Values which are T objects living outside of the Vector are hashed by reference,
+        /// any other values (temporaries, converted values or elements of the Vector itself) are copied into the set first
+        /// </summary>
+        template<class Range, class Hash, class KeyEqual>
+        void RemoveByMembershipGenericImplementation( const Range& values, const Hash& hash, const KeyEqual& equal, const bool removeMembers )
+        {
+            using Iterator = decltype(std::begin( values ));
+            using Reference = decltype(*std::begin( values ));
+            if constexpr( std::is_lvalue_reference_v<Reference> && std::is_same_v<std::decay_t<Reference>, T> && !std::is_same_v<T, bool>
+                && std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category> )
+            {
+                if( !OverlapsGenericImplementation( values ) )
+                {
+                    auto referenceHash = [&hash]( const std::reference_wrapper<const T> value ) { return hash( value.get() ); };
+                    auto referenceEqual = [&equal]( const std::reference_wrapper<const T> left, const std::reference_wrapper<const T> right ) { return equal( left.get(), right.get() ); };
+                    std::unordered_set<std::reference_wrapper<const T>, decltype(referenceHash), decltype(referenceEqual)> members( 0, referenceHash, referenceEqual );
+                    if constexpr( IsSizedRange<const Range>::value )
+                        members.reserve( std::size( values ) );
+                    for( const T& value : values )
+                        members.insert( std::cref( value ) );
+                    this->erase( std::remove_if( this->begin(), this->end(),
+                        [&]( const T& element ) { return (members.find( std::cref( element ) ) != members.end()) == removeMembers; } ), this->end() );
+                    return;
+                }
+            }
+            std::unordered_set<T, Hash, KeyEqual> members( std::begin( values ), std::end( values ), 0, hash, equal );
+            this->erase( std::remove_if( this->begin(), this->end(),
+                [&]( const T& element ) { return (members.find( element ) != members.end()) == removeMembers; } ), this->end() );
+        }
+
+
+        /// <summary>
+        /// Determines whether any of the T objects referenced by the range lies within the storage of the Vector
+        /// </summary>
+        template<class Range>
+        bool OverlapsGenericImplementation( const Range& values ) const noexcept
+        {
+            const std::less<const T*> before;
+            const T* const first = this->data();
+            const T* const last = first + this->size();
+            for( const T& value : values )
+                if( !before( &value, first ) && before( &value, last ) )
+                    return true;
+            return false;
+        }
+
+
+        const int IndexOfGenericImplementation( const T& item, const unsigned int start, const unsigned int count ) const
+        {
+            if( start + count > this->size() )
+                throw std::invalid_argument( "search range exceeds containers size" );
+            constexpr int result = -1;
+            if constexpr( SimdSearch::Supports<T>::value )
+            {
+                const auto index = SimdSearch::Find( this->data() + start, count, item );
+                return index != count ? static_cast<int>(start + index) : result;
+            }
+            for( unsigned int index = start; index < start + count; ++index )
+                if( this->operator[]( index ) == item )
+                    return index;
+            return result;
+        }
+
+
+        const int LastIndexOfGenericImplementation( const T& item, const unsigned int start, const unsigned int count ) const
+        {
+            if( start + count > this->size() )
+                throw std::invalid_argument( "search range exceeds containers size" );
+            constexpr int result = -1;
+            if constexpr( SimdSearch::Supports<T>::value )
+            {
+                const auto index = SimdSearch::FindLast( this->data() + start, count, item );
+                return index != count ? static_cast<int>(start + index) : result;
+            }
+            for( unsigned int index = start + count; index > start; --index )
+                if( this->operator[]( index - 1 ) == item )
+                    return index - 1;
+            return result;
+        }
+
+
+        template<class Predicate>
+        const int FindIndexGenericImplementation( Predicate& predicate, const unsigned int start, const unsigned int count ) const
+        {
+            if( start + count > this->size() )
+                throw std::invalid_argument( "search range exceeds containers size" );
+            constexpr int result = -1;
+            for( unsigned int index = start; index < start + count; ++index )
+                if( predicate( this->operator[]( index ) ) )
+                    return index;
+            return result;
+        }
+
+
+        /// <summary>
+        /// Scans the elements from end - 1 down to start and returns the absolute index of the first one matching the predicate
+        /// </summary>
+        template<class Predicate>
+        const int FindLastIndexGenericImplementation( Predicate& predicate, const unsigned int start, const unsigned int end ) const
+        {
+            constexpr int result = -1;
+            for( unsigned int index = end; index > start; --index )
+                if( predicate( this->operator[]( index - 1 ) ) )
+                    return index - 1;
+            return result;
+        }
+    };
+
+
+    /// <summary>
+    /// Vector which keeps track of whether its elements are known to be sorted in ascending order.
+    /// While they are, Contains, IndexOf, LastIndexOf and Remove use binary search instead of the linear scan.
+    /// Sort() and InsertSorted() set the state, appending keeps it only if the appended elements continue the order and every other method which may reorder the elements clears it.
+    /// The non-const element access and iterators clear it as well, so use cbegin(), cend() or a const reference to read the elements without losing it.
+    /// Modifications done through a reference to the Vector or std::vector base are not tracked: call MarkUnsorted() after doing so
+    /// </summary>
+    template<class T, class Allocator = std::allocator<T>>
+    class SortedVector : public Vector<T, Allocator>
+    {
+        static_assert( IsLessThanComparable<T>::value, "SortedVector requires the elements to be comparable with operator<" );
+
+    public:
+#pragma region Constructors
+        SortedVector() noexcept( noexcept( Allocator() ) ) : Vector<T, Allocator>(), knownSorted( true )
+        {}
+
+        explicit SortedVector( const Allocator& allocator ) noexcept : Vector<T, Allocator>( allocator ), knownSorted( true )
+        {}
+
+        using Vector<T, Allocator>::Vector;
+#pragma endregion
+
+#pragma region SortState
+        /// <summary>
+        /// Determines whether the elements are known to be sorted in ascending order, so that the lookups use binary search
+        /// </summary>
+        bool IsKnownSorted() const noexcept
+        {
+            return knownSorted;
+        }
+
+        /// <summary>
+        /// Makes the lookups use the linear scan until the next Sort()
+        /// </summary>
+        void MarkUnsorted() noexcept
+        {
+            knownSorted = false;
+        }
+#pragma endregion
+
+#pragma region Sort
+        /// <summary>
+        /// Sorts the elements in the Vector in ascending order and marks them as sorted
+        /// </summary>
+        void Sort()
+        {
+            Vector<T, Allocator>::Sort();
+            knownSorted = true;
+        }
+
+        /// <summary>
+        /// Sorts a portion of the elements in the Vector. The Vector stays known to be sorted only if it was before
+        /// </summary>
+        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
+        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
+        void Sort( const unsigned int positionBegin, const unsigned int positionEnd )
+        {
+            Vector<T, Allocator>::Sort( positionBegin, positionEnd );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector in ascending order using the specified execution policy and marks them as sorted
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should sort the Vector</param>
+        template<class Policy, EnableIfExecutionPolicy<Policy> = 0>
+        void Sort( Policy&& policy )
+        {
+            Vector<T, Allocator>::Sort( std::forward<Policy>( policy ) );
+            knownSorted = true;
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector using the specified comparer, which clears the sorted state
+        /// </summary>
+        /// <param name="comparer">Callable determining the sort order</param>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        void Sort( Comparer&& comparer )
+        {
+            knownSorted = false;
+            Vector<T, Allocator>::Sort( std::forward<Comparer>( comparer ) );
+        }
+
+        /// <summary>
+        /// Sorts a portion of the elements in the Vector using the specified comparer, which clears the sorted state
+        /// </summary>
+        /// <param name="positionBegin">Index of the first element of the portion to sort</param>
+        /// <param name="positionEnd">Index of the last element of the portion to sort</param>
+        /// <param name="comparer">Callable determining the sort order</param>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        void Sort( const unsigned int positionBegin, const unsigned int positionEnd, Comparer&& comparer )
+        {
+            knownSorted = false;
+            Vector<T, Allocator>::Sort( positionBegin, positionEnd, std::forward<Comparer>( comparer ) );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector using the specified comparer and execution policy, which clears the sorted state
+        /// </summary>
+        /// <param name="policy">Cx::seq, Cx::par, Cx::par_unseq or the ExecutionContext whose threads should sort the Vector</param>
+        /// <param name="comparer">Callable determining the sort order. It is called concurrently from several threads</param>
+        template<class Policy, class Comparer, EnableIfExecutionPolicy<Policy> = 0, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        void Sort( Policy&& policy, Comparer&& comparer )
+        {
+            knownSorted = false;
+            Vector<T, Allocator>::Sort( std::forward<Policy>( policy ), std::forward<Comparer>( comparer ) );
+        }
+
+        /// <summary>
+        /// Sorts the elements in the Vector by the key extracted by the specified projection, which clears the sorted state
+        /// </summary>
+        /// <param name="projection">Callable returning the integral or floating-point key of an element</param>
+        template<class Projection>
+        void SortByKey( Projection&& projection )
+        {
+            knownSorted = false;
+            Vector<T, Allocator>::SortByKey( std::forward<Projection>( projection ) );
+        }
+#pragma endregion
+
+#pragma region InsertSorted
+        /// <summary>
+        /// Inserts the item after all elements not greater than it, so that the Vector stays sorted. Throws std::logic_error if the Vector is not known to be sorted
+        /// </summary>
+        /// <param name="item">The object to insert</param>
+        /// <returns>The zero-based index at which the item has been inserted</returns>
+        int InsertSorted( const T& item )
+        {
+            if( !knownSorted )
+                throw std::logic_error( "sorted insert requires sorted Vector" );
+            const auto position = UpperBound( item );
+            std::vector<T, Allocator>::insert( this->cbegin() + position, item );
+            return static_cast<int>(position);
+        }
+
+        /// <summary>
+        /// Moves the item after all elements not greater than it, so that the Vector stays sorted. Throws std::logic_error if the Vector is not known to be sorted
+        /// </summary>
+        /// <param name="item">The object to insert</param>
+        /// <returns>The zero-based index at which the item has been inserted</returns>
+        int InsertSorted( T&& item )
+        {
+            if( !knownSorted )
+                throw std::logic_error( "sorted insert requires sorted Vector" );
+            const auto position = UpperBound( item );
+            std::vector<T, Allocator>::insert( this->cbegin() + position, std::move( item ) );
+            return static_cast<int>(position);
+        }
+#pragma endregion
+
+#pragma region AddRange
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector. The Vector stays known to be sorted if the added elements continue its order
+        /// </summary>
+        /// <param name="list">The collection whose elements should be added to the end of the Vector.</param>
+        void AddRange( const std::initializer_list<T>& list ) noexcept
+        {
+            const auto oldSize = this->size();
+            Vector<T, Allocator>::AddRange( list );
+            UpdateSortedAfterInsert( oldSize, this->size() - oldSize );
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the Vector. The Vector stays known to be sorted if the added elements continue its order
+        /// </summary>
+        /// <param name="arguments">Any of the collections accepted by Vector::AddRange</param>
+        template<class... Arguments>
+        void AddRange( Arguments&&... arguments )
+        {
+            const auto oldSize = this->size();
+            Vector<T, Allocator>::AddRange( std::forward<Arguments>( arguments )... );
+            UpdateSortedAfterInsert( oldSize, this->size() - oldSize );
+        }
+
+        void push_back( const T& item )
+        {
+            std::vector<T, Allocator>::push_back( item );
+            UpdateSortedAfterInsert( this->size() - 1, 1 );
+        }
+
+        void push_back( T&& item )
+        {
+            std::vector<T, Allocator>::push_back( std::move( item ) );
+            UpdateSortedAfterInsert( this->size() - 1, 1 );
+        }
+
+        template<class... Arguments>
+        T& emplace_back( Arguments&&... arguments )
+        {
+            std::vector<T, Allocator>::emplace_back( std::forward<Arguments>( arguments )... );
+            UpdateSortedAfterInsert( this->size() - 1, 1 );
+            return std::vector<T, Allocator>::back();
+        }
+#pragma endregion
+
+#pragma region InsertRange
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index. The Vector stays known to be sorted if the inserted elements fit the order at that index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="range">The collection whose elements should be inserted into the Vector</param>
+        void InsertRange( const unsigned int index, const std::vector<T, Allocator>& range )
+        {
+            const auto oldSize = this->size();
+            Vector<T, Allocator>::InsertRange( index, range );
+            UpdateSortedAfterInsert( index, this->size() - oldSize );
+        }
+
+        /// <summary>
+        /// Inserts the elements of a collection into the Vector at the specified index. The Vector stays known to be sorted if the inserted elements fit the order at that index
+        /// </summary>
+        /// <param name="index">The zero-based index at which the new elements should be inserted</param>
+        /// <param name="arguments">Any of the collections accepted by Vector::InsertRange</param>
+        template<class... Arguments>
+        void InsertRange( const unsigned int index, Arguments&&... arguments )
+        {
+            const auto oldSize = this->size();
+            Vector<T, Allocator>::InsertRange( index, std::forward<Arguments>( arguments )... );
+            UpdateSortedAfterInsert( index, this->size() - oldSize );
+        }
+
+        template<class... Arguments>
+        auto insert( Arguments&&... arguments )
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::insert( std::forward<Arguments>( arguments )... );
+        }
+
+        auto insert( typename std::vector<T, Allocator>::const_iterator position, std::initializer_list<T> list )
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::insert( position, list );
+        }
+
+        template<class... Arguments>
+        auto emplace( Arguments&&... arguments )
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::emplace( std::forward<Arguments>( arguments )... );
+        }
+#pragma endregion
+
+#pragma region Contains
+        /// <summary>
+        /// Determines whether an element is in the Vector, using binary search while the Vector is known to be sorted
+        /// </summary>
+        /// <param name="item">The object to locate in the Vector</param>
+        /// <returns>true if item is found in the Vector, false otherwise</returns>
+        bool Contains( const T& item ) const noexcept
+        {
+            if( !knownSorted )
+                return Vector<T, Allocator>::Contains( item );
+            return SortedIndexOf( item ) >= 0;
+        }
+#pragma endregion
+
+#pragma region IndexOf
+        using Vector<T, Allocator>::IndexOf;
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the first occurrence within the entire Vector, using binary search while the Vector is known to be sorted
+        /// </summary>
+        /// <param name="element">The object to locate in the Vector</param>
+        /// <returns>The zero-based index of the first occurrence of item within the entire Vector if found; -1 otherwise</returns>
+        const int IndexOf( const T& element ) const
+        {
+            if( !knownSorted )
+                return Vector<T, Allocator>::IndexOf( element );
+            return SortedIndexOf( element );
+        }
+#pragma endregion
+
+#pragma region LastIndexOf
+        using Vector<T, Allocator>::LastIndexOf;
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the last occurrence within the entire Vector, using binary search while the Vector is known to be sorted
+        /// </summary>
+        /// <param name="item">The object to locate in the Vector</param>
+        /// <returns>The zero-based index of the last occurrence of item within the entire Vector if found; -1 otherwise</returns>
+        const int LastIndexOf( const T& item ) const noexcept
+        {
+            if( !knownSorted )
+                return Vector<T, Allocator>::LastIndexOf( item );
+            for( auto index = UpperBound( item ); index > 0 && !(this->operator[]( index - 1 ) < item); --index )
+                if( this->operator[]( index - 1 ) == item )
+                    return static_cast<int>(index - 1);
+            return -1;
+        }
+#pragma endregion
+
+#pragma region Remove
+        /// <summary>
+        /// Removes the first occurrence of a specific object from the Vector, using binary search while the Vector is known to be sorted
+        /// </summary>
+        /// <param name="item">The object to remove from the Vector</param>
+        void Remove( const T& item ) noexcept
+        {
+            if( !knownSorted )
+                return Vector<T, Allocator>::Remove( item );
+            const int index = SortedIndexOf( item );
+            if( index >= 0 )
+                this->RemoveAt( index );
+        }
+#pragma endregion
+
+#pragma region RemoveUnordered
+        /// <summary>
+        /// Removes the element at specified index of the Vector by moving the last element into its place, which clears the sorted state unless the last element is removed
+        /// </summary>
+        /// <param name="index">The zero-based index of the element to remove</param>
+        void RemoveAtSwapBack( const unsigned int index )
+        {
+            knownSorted = knownSorted && index + 1 >= this->size();
+            Vector<T, Allocator>::RemoveAtSwapBack( index );
+        }
+
+        /// <summary>
+        /// Removes the first occurrence of a specific object from the Vector. While the Vector is known to be sorted, this is Remove( item ), which keeps the order
+        /// </summary>
+        /// <param name="item">The object to remove from the Vector</param>
+        void RemoveUnordered( const T& item ) noexcept
+        {
+            if( knownSorted )
+                return Remove( item );
+            Vector<T, Allocator>::RemoveUnordered( item );
+        }
+
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate without preserving the order, which clears the sorted state
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to remove</param>
+        template<class Predicate>
+        void RemoveAllUnordered( Predicate&& predicate )
+        {
+            knownSorted = false;
+            Vector<T, Allocator>::RemoveAllUnordered( std::forward<Predicate>( predicate ) );
+        }
+#pragma endregion
+
+#pragma region RemoveAllOf
+        /// <summary>
+        /// Removes all the elements that are equal to any of the specified values. While the Vector is known to be sorted and the values are sorted too,
+        /// both are merged in a single pass instead of building a hash set, unless a custom equality comparison is given
+        /// </summary>
+        /// <param name="values">The range of the values to remove from the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Range, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, EnableIfRange<Range, void> = 0>
+        void RemoveAllOf( const Range& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            if( !std::is_same_v<KeyEqual, std::equal_to<T>> || !RemoveBySortedMembershipGenericImplementation( values, true ) )
+                Vector<T, Allocator>::RemoveAllOf( values, hash, equal );
+        }
+
+        /// <summary>
+        /// Removes all the elements that are equal to any of the specified values, merging them with the Vector while both are sorted
+        /// </summary>
+        /// <param name="values">The values to remove from the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>>
+        void RemoveAllOf( const std::initializer_list<T>& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            if( !std::is_same_v<KeyEqual, std::equal_to<T>> || !RemoveBySortedMembershipGenericImplementation( values, true ) )
+                Vector<T, Allocator>::RemoveAllOf( values, hash, equal );
+        }
+
+        /// <summary>
+        /// Removes all the elements that are not equal to any of the specified values. While the Vector is known to be sorted and the values are sorted too,
+        /// both are merged in a single pass instead of building a hash set, unless a custom equality comparison is given
+        /// </summary>
+        /// <param name="values">The range of the values to keep in the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Range, class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>, EnableIfRange<Range, void> = 0>
+        void RetainAllOf( const Range& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            if( !std::is_same_v<KeyEqual, std::equal_to<T>> || !RemoveBySortedMembershipGenericImplementation( values, false ) )
+                Vector<T, Allocator>::RetainAllOf( values, hash, equal );
+        }
+
+        /// <summary>
+        /// Removes all the elements that are not equal to any of the specified values, merging them with the Vector while both are sorted
+        /// </summary>
+        /// <param name="values">The values to keep in the Vector</param>
+        /// <param name="hash">The hash function applied to the values and to the elements</param>
+        /// <param name="equal">The equality comparison of the values and the elements, which has to be consistent with hash</param>
+        template<class Hash = std::hash<T>, class KeyEqual = std::equal_to<T>>
+        void RetainAllOf( const std::initializer_list<T>& values, const Hash& hash = Hash(), const KeyEqual& equal = KeyEqual() )
+        {
+            if( !std::is_same_v<KeyEqual, std::equal_to<T>> || !RemoveBySortedMembershipGenericImplementation( values, false ) )
+                Vector<T, Allocator>::RetainAllOf( values, hash, equal );
+        }
+#pragma endregion
+
+#pragma region Reorder
+        /// <summary>
+        /// Reverses the order of the elements in the entire Vector, which clears the sorted state
+        /// </summary>
+        void Reverse() noexcept
+        {
+            knownSorted = knownSorted && this->size() < 2;
+            Vector<T, Allocator>::Reverse();
+        }
+
+        /// <summary>
+        /// Reverses the order of the elements in the specified range, which clears the sorted state
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the range to reverse</param>
+        /// <param name="count">The number of elements in the range to reverse</param>
+        void Reverse( const unsigned int start, const unsigned int count )
+        {
+            Vector<T, Allocator>::Reverse( start, count );
+            knownSorted = knownSorted && count < 2;
+        }
+
+        /// <summary>
+        /// Performs the specified action on each element of the Vector, which clears the sorted state
+        /// </summary>
+        /// <param name="arguments">The action, optionally preceded by the execution policy, as accepted by Vector::ForEach</param>
+        template<class... Arguments>
+        void ForEach( Arguments&&... arguments )
+        {
+            knownSorted = false;
+            Vector<T, Allocator>::ForEach( std::forward<Arguments>( arguments )... );
+        }
+
+        template<class... Arguments>
+        void assign( Arguments&&... arguments )
+        {
+            knownSorted = false;
+            std::vector<T, Allocator>::assign( std::forward<Arguments>( arguments )... );
+        }
+
+        void assign( std::initializer_list<T> list )
+        {
+            knownSorted = false;
+            std::vector<T, Allocator>::assign( list );
+        }
+
+        template<class... Arguments>
+        void resize( Arguments&&... arguments )
+        {
+            const auto oldSize = this->size();
+            std::vector<T, Allocator>::resize( std::forward<Arguments>( arguments )... );
+            if( this->size() > oldSize )
+                UpdateSortedAfterInsert( oldSize, this->size() - oldSize );
+        }
+
+        void clear() noexcept
+        {
+            std::vector<T, Allocator>::clear();
+            knownSorted = true;
+        }
+
+        void swap( SortedVector& other ) noexcept
+        {
+            std::vector<T, Allocator>::swap( other );
+            std::swap( knownSorted, other.knownSorted );
+        }
+#pragma endregion
+
+#pragma region ElementAccess
+        using Vector<T, Allocator>::operator[];
+        using Vector<T, Allocator>::at;
+        using Vector<T, Allocator>::front;
+        using Vector<T, Allocator>::back;
+        using Vector<T, Allocator>::data;
+        using Vector<T, Allocator>::begin;
+        using Vector<T, Allocator>::end;
+        using Vector<T, Allocator>::rbegin;
+        using Vector<T, Allocator>::rend;
+
+        T& operator[]( const std::size_t index ) noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::operator[]( index );
+        }
+
+        T& at( const std::size_t index )
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::at( index );
+        }
+
+        T& front() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::front();
+        }
+
+        T& back() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::back();
+        }
+
+        T* data() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::data();
+        }
+
+        typename std::vector<T, Allocator>::iterator begin() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::begin();
+        }
+
+        typename std::vector<T, Allocator>::iterator end() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::end();
+        }
+
+        typename std::vector<T, Allocator>::reverse_iterator rbegin() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::rbegin();
+        }
+
+        typename std::vector<T, Allocator>::reverse_iterator rend() noexcept
+        {
+            knownSorted = false;
+            return std::vector<T, Allocator>::rend();
+        }
+#pragma endregion
+
+    private:
+        bool knownSorted = false;
+
+        /// <summary>
+        /// Removes the elements whose membership in values equals removeMembers by walking the Vector and the values side by side.
+        /// Returns false without changing anything when the Vector is not known to be sorted, the values are not sorted or some of them are elements of the Vector
+        /// </summary>
+        template<class Range>
+        bool RemoveBySortedMembershipGenericImplementation( const Range& values, const bool removeMembers )
+        {
+            using Iterator = decltype(std::begin( values ));
+            using Reference = decltype(*std::begin( values ));
+            if constexpr( IsLessThanComparable<T>::value && std::is_same_v<std::decay_t<Reference>, T> && !std::is_same_v<T, bool>
+                && std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<Iterator>::iterator_category> )
+            {
+                if( !knownSorted )
+                    return false;
+                const std::less<const T*> before;
+                const T* const first = std::vector<T, Allocator>::data();
+                const T* const last = first + this->size();
+                for( auto value = std::begin( values ), previous = value; value != std::end( values ); previous = value++ )
+                {
+                    if( *value < *previous )
+                        return false;
+                    if constexpr( std::is_lvalue_reference_v<Reference> )
+                        if( !before( &*value, first ) && before( &*value, last ) )
+                            return false;
+                }
+
+                auto value = std::begin( values );
+                const auto lastValue = std::end( values );
+                auto destination = std::vector<T, Allocator>::begin();
+                for( auto source = destination; source != std::vector<T, Allocator>::end(); ++source )
+                {
+                    while( value != lastValue && *value < *source )
+                        ++value;
+                    const bool member = value != lastValue && !(*source < *value);
+                    if( member == removeMembers )
+                        continue;
+                    if( destination != source )
+                        *destination = std::move( *source );
+                    ++destination;
+                }
+                std::vector<T, Allocator>::erase( destination, std::vector<T, Allocator>::end() );
+                return true;
+            }
+            else
+            {
+                (void)values;
+                (void)removeMembers;
+                return false;
+            }
+        }
+
+        std::size_t UpperBound( const T& item ) const
+        {
+            return static_cast<std::size_t>(std::upper_bound( this->cbegin(), this->cend(), item,
+                []( const T& left, const T& right ) { return left < right; } ) - this->cbegin());
+        }
+
+        /// <summary>
+        /// Finds the first element equal to the item among the elements equivalent to it, which start at the lower bound found by BinarySearch
+        /// </summary>
+        int SortedIndexOf( const T& item ) const noexcept
+        {
+            const int found = this->BinarySearch( item );
+            if( found < 0 )
+                return -1;
+            for( auto index = static_cast<std::size_t>(found); index < this->size() && !(item < this->operator[]( index )); ++index )
+                if( this->operator[]( index ) == item )
+                    return static_cast<int>(index);
+            return -1;
+        }
+
+        /// <summary>
+        /// Keeps the sorted state only if the count elements inserted at the index are in order with each other and with their neighbours
+        /// </summary>
+        void UpdateSortedAfterInsert( const std::size_t index, const std::size_t count ) noexcept
+        {
+            if( !knownSorted || count == 0 )
+                return;
+            const auto first = this->cbegin() + (index > 0 ? index - 1 : 0);
+            const auto last = this->cbegin() + std::min( index + count + 1, this->size() );
+            knownSorted = std::is_sorted( first, last, []( const T& left, const T& right ) { return left < right; } );
+        }
+    };
+
+
+    /// <summary>
+    /// Frozen copy of the elements of a sorted Vector laid out in Eytzinger (breadth-first) order, so that each step of a search touches a predictable, prefetchable cache line.
+    /// The index is a snapshot: later changes to the Vector are not reflected, and the positions it returns refer to the Vector as it was when the index was built
+    /// </summary>
+    template<class T>
+    class SearchIndex
+    {
+        static_assert( IsLessThanComparable<T>::value && !std::is_same_v<T, bool>, "SearchIndex requires elements ordered by operator< and stored contiguously" );
+
+    public:
+        /// <summary>
+        /// Copies the elements of the Vector, which must be sorted in ascending order
+        /// </summary>
+        /// <param name="sorted">The Vector to index</param>
+        template<class Allocator>
+        explicit SearchIndex( const Vector<T, Allocator>& sorted )
+            : keys( sorted.size() + 1 ), height( sorted.empty() ? 0 : BitScan::FloorLog2( sorted.size() ) ), count( sorted.size() )
+        {
+            if( !std::is_sorted( sorted.cbegin(), sorted.cend(), []( const T& left, const T& right ) { return left < right; } ) )
+                throw std::logic_error( "search index requires sorted Vector" );
+            Fill( sorted, 0, 1 );
+        }
+
+        /// <summary>
+        /// Gets the number of elements in the index
+        /// </summary>
+        std::size_t size() const noexcept
+        {
+            return count;
+        }
+
+        /// <summary>
+        /// Searches the index for an element using the default comparer and returns the zero-based index of the element
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <returns>The zero-based index of item in the indexed Vector, if item is found; otherwise, a negative number that is the bitwise complement of the index of the next element that is larger than item or, if there is no larger element, the bitwise complement of size()</returns>
+        int BinarySearch( const T& item ) const
+        {
+            const std::size_t node = LowerBound( item );
+            if( node == 0 )
+                return ~static_cast<int>(count);
+            const auto position = static_cast<int>(PositionOf( node ));
+            return item < keys[node] ? ~position : position;
+        }
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the first occurrence in the indexed Vector.
+        /// The elements which are not ordered before or after item are compared with operator==, as SortedVector does
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <returns>The zero-based index of the first occurrence of item if found; -1 otherwise</returns>
+        int IndexOf( const T& item ) const
+        {
+            std::size_t node = LowerBound( item );
+            if( node == 0 )
+                return -1;
+            for( std::size_t position = PositionOf( node ); node != 0 && !(item < keys[node]); node = NextInOrder( node ), ++position )
+                if( keys[node] == item )
+                    return static_cast<int>(position);
+            return -1;
+        }
+
+        /// <summary>
+        /// Determines whether an element is in the indexed Vector
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <returns>true if item is found; otherwise, false</returns>
+        bool Contains( const T& item ) const
+        {
+            return IndexOf( item ) >= 0;
+        }
+
+    private:
+        // keys[0] is unused so that the children of node k are 2k and 2k + 1
+        std::vector<T> keys;
+        std::size_t height;
+        std::size_t count;
+
+        template<class Allocator>
+        std::size_t Fill( const Vector<T, Allocator>& sorted, std::size_t position, const std::size_t node )
+        {
+            if( node > count )
+                return position;
+            position = Fill( sorted, position, 2 * node );
+            keys[node] = sorted[position];
+            return Fill( sorted, position + 1, 2 * node + 1 );
+        }
+
+        /// <summary>
+        /// Descends the tree without branches, prefetching the node several levels below, and returns the node holding the lower bound of item, or 0 if all elements are less than item
+        /// </summary>
+        std::size_t LowerBound( const T& item ) const
+        {
+            constexpr std::size_t prefetchDistance = std::max<std::size_t>( 64 / sizeof( T ), 1 );
+            std::size_t node = 1;
+            while( node <= count )
+            {
+                CacheHint::Prefetch( keys.data() + std::min( node * prefetchDistance, count ) );
+                node = 2 * node + (keys[node] < item ? 1 : 0);
+            }
+            // The trailing ones are the right turns taken after the last left turn, which was made at the lower bound
+            ++node;
+            return node >> (BitScan::CountTrailingZeros( node ) + 1);
+        }
+
+        /// <summary>
+        /// The in-order position of a node is computed from its place in a perfect tree of the same height, minus the missing nodes of the last level before it
+        /// </summary>
+        std::size_t PositionOf( const std::size_t node ) const noexcept
+        {
+            const std::size_t depth = BitScan::FloorLog2( node );
+            const std::size_t perfectPosition = ((2 * (node - (std::size_t( 1 ) << depth)) + 1) << (height - depth)) - 1;
+            const std::size_t lastLevelCount = count - ((std::size_t( 1 ) << height) - 1);
+            const std::size_t lastLevelBefore = (perfectPosition + 1) / 2;
+            return perfectPosition - (lastLevelBefore > lastLevelCount ? lastLevelBefore - lastLevelCount : 0);
+        }
+
+        /// <summary>
+        /// Returns the node following the given one in sorted order, or 0 after the last node
+        /// </summary>
+        std::size_t NextInOrder( std::size_t node ) const noexcept
+        {
+            if( 2 * node + 1 <= count )
+            {
+                node = 2 * node + 1;
+                while( 2 * node <= count )
+                    node *= 2;
+                return node;
+            }
+            while( node & 1 )
+                node >>= 1;
+            return node >> 1;
+        }
+    };
+
+
+    /// <summary>
+    /// Vector which keeps up to N elements inside the object itself and moves them to the heap only when it grows beyond N.
+    /// All the methods of Vector are available and work on the inline elements without any allocation, while the Vectors they return (FindAll, GetRange, ConvertAll) use the heap.
+    /// Copying and moving a SmallVector copies or moves its elements one by one, and swap is done with three moves, because the inline elements cannot change their owner
+    /// </summary>
+    template<class T, std::size_t N>
+    class SmallVector : private InlineBuffer<T, N>, public Vector<T, InlineBufferAllocator<T, N>>
+    {
+        static_assert( N > 0, "SmallVector requires room for at least one inline element" );
+
+    public:
+#pragma region Constructors
+        SmallVector() noexcept : InlineBuffer<T, N>(), Vector<T, InlineBufferAllocator<T, N>>( InlineBufferAllocator<T, N>( this ) )
+        {
+            this->reserve( N );
+        }
+
+        SmallVector( std::initializer_list<T> initialValues ) : SmallVector()
+        {
+            this->insert( this->cend(), initialValues );
+        }
+
+        SmallVector( const SmallVector& other ) : SmallVector()
+        {
+            this->insert( this->cend(), other.cbegin(), other.cend() );
+        }
+
+        SmallVector( SmallVector&& other ) : SmallVector()
+        {
+            this->insert( this->cend(), std::make_move_iterator( other.begin() ), std::make_move_iterator( other.end() ) );
+            other.clear();
+        }
+
+        SmallVector& operator=( const SmallVector& other )
+        {
+            if( this != &other && other.size() <= N )
+                ReturnToInlineStorage();
+            Vector<T, InlineBufferAllocator<T, N>>::operator=( other );
+            return *this;
+        }
+
+        SmallVector& operator=( SmallVector&& other )
+        {
+            if( this == &other )
+                return *this;
+            if( other.size() <= N )
+                ReturnToInlineStorage();
+            Vector<T, InlineBufferAllocator<T, N>>::operator=( std::move( other ) );
+            other.clear();
+            return *this;
+        }
+#pragma endregion
+
+#pragma region Storage
+        /// <summary>
+        /// Determines whether the elements are currently kept inside the SmallVector rather than on the heap
+        /// </summary>
+        /// <returns>true if no heap memory is used by the elements; false otherwise</returns>
+        bool IsInline() const noexcept
+        {
+            return static_cast<const void*>(this->data()) == static_cast<const void*>(this->bytes);
+        }
+
+        void swap( SmallVector& other )
+        {
+            SmallVector temporary( std::move( other ) );
+            other = std::move( *this );
+            *this = std::move( temporary );
+        }
+#pragma endregion
+
+    private:
+        /// <summary>
+        /// Releases the heap memory of the elements, leaving the SmallVector empty with its inline capacity
+        /// </summary>
+        void ReturnToInlineStorage()
+        {
+            if( IsInline() )
+                return;
+            std::vector<T, InlineBufferAllocator<T, N>>( this->get_allocator() ).swap( *this );
+            this->reserve( N );
+        }
+    };
+
+
+    /// <summary>
+    /// Overflow policy of StaticVector which throws std::length_error when an operation would exceed the capacity, and std::out_of_range when pop_back() is called on an empty StaticVector
+    /// </summary>
+    struct ThrowOnOverflow
+    {
+        static bool Overflow()
+        {
+            throw std::length_error( "StaticVector capacity exceeded" );
+        }
+
+        static bool Underflow()
+        {
+            throw std::out_of_range( "pop_back() called on empty StaticVector" );
+        }
+    };
+
+    /// <summary>
+    /// Overflow policy of StaticVector which fails an assertion when an operation would exceed the capacity or pop_back() is called on an empty StaticVector.
+    /// With NDEBUG defined the operation is skipped and reports false instead
+    /// </summary>
+    struct AssertOnOverflow
+    {
+        static bool Overflow() noexcept
+        {
+            assert( !"StaticVector capacity exceeded" );
+            return false;
+        }
+
+        static bool Underflow() noexcept
+        {
+            assert( !"pop_back() called on empty StaticVector" );
+            return false;
+        }
+    };
+
+    /// <summary>
+    /// Overflow policy of StaticVector which skips an operation that would exceed the capacity, or a pop_back() on an empty StaticVector, and reports it only through the false result of the operation.
+    /// It is the only policy which lets an overflow happen during constant evaluation; with the other ones an overflow makes the expression not constant
+    /// </summary>
+    struct ReportOnOverflow
+    {
+        static constexpr bool Overflow() noexcept
+        {
+            return false;
+        }
+
+        static constexpr bool Underflow() noexcept
+        {
+            return false;
+        }
+    };
+
+    /// <summary>
+    /// Vector with a fixed capacity of N elements stored inside the object, which never allocates and can be used in constexpr contexts.
+    /// The elements live in a std::array, so T has to be default constructible and assignable, and literal for constant evaluation.
+    /// Operations which add elements return false instead of exceeding the capacity if OverflowPolicy lets them return
+    /// </summary>
+    template<class T, std::size_t N, class OverflowPolicy = ThrowOnOverflow>
+    class StaticVector
+    {
+    public:
+        using value_type = T;
+        using size_type = std::size_t;
+        using iterator = T*;
+        using const_iterator = const T*;
+
+#pragma region Constructors
+        constexpr StaticVector() = default;
+
+        constexpr StaticVector( std::initializer_list<T> initialValues )
+        {
+            AddRange( initialValues );
+        }
+#pragma endregion
+
+#pragma region Storage
+        constexpr std::size_t size() const noexcept { return length; }
+        static constexpr std::size_t capacity() noexcept { return N; }
+        constexpr bool empty() const noexcept { return length == 0; }
+        constexpr bool full() const noexcept { return length == N; }
+
+        constexpr T* data() noexcept { return elements.data(); }
+        constexpr const T* data() const noexcept { return elements.data(); }
+        constexpr iterator begin() noexcept { return elements.data(); }
+        constexpr iterator end() noexcept { return elements.data() + length; }
+        constexpr const_iterator begin() const noexcept { return elements.data(); }
+        constexpr const_iterator end() const noexcept { return elements.data() + length; }
+        constexpr const_iterator cbegin() const noexcept { return elements.data(); }
+        constexpr const_iterator cend() const noexcept { return elements.data() + length; }
+
+        constexpr T& operator[]( const std::size_t index ) noexcept { return elements[index]; }
+        constexpr const T& operator[]( const std::size_t index ) const noexcept { return elements[index]; }
+        constexpr T& front() noexcept { return elements[0]; }
+        constexpr const T& front() const noexcept { return elements[0]; }
+        constexpr T& back() noexcept { return elements[length - 1]; }
+        constexpr const T& back() const noexcept { return elements[length - 1]; }
+
+        constexpr T& at( const std::size_t index )
+        {
+            if( index >= length )
+                throw std::out_of_range( "index exceeds the size of StaticVector" );
+            return elements[index];
+        }
+
+        constexpr const T& at( const std::size_t index ) const
+        {
+            if( index >= length )
+                throw std::out_of_range( "index exceeds the size of StaticVector" );
+            return elements[index];
+        }
+
+        /// <summary>
+        /// Adds an object to the end of the StaticVector
+        /// </summary>
+        /// <param name="item">The object to be added</param>
+        /// <returns>true if the object was added; false if the StaticVector is full and OverflowPolicy did not throw</returns>
+        constexpr bool push_back( const T& item )
+        {
+            if( length == N )
+                return OverflowPolicy::Overflow();
+            elements[length++] = item;
+            return true;
+        }
+
+        constexpr bool push_back( T&& item )
+        {
+            if( length == N )
+                return OverflowPolicy::Overflow();
+            elements[length++] = std::move( item );
+            return true;
+        }
+
+        template<class... Arguments>
+        constexpr bool emplace_back( Arguments&&... arguments )
+        {
+            if( length == N )
+                return OverflowPolicy::Overflow();
+            elements[length++] = T( std::forward<Arguments>( arguments )... );
+            return true;
+        }
+
+        /// <summary>
+        /// Removes the last element of the StaticVector
+        /// </summary>
+        /// <returns>true if an element was removed; false if the StaticVector is empty and OverflowPolicy did not throw</returns>
+        constexpr bool pop_back() noexcept( noexcept( OverflowPolicy::Underflow() ) )
+        {
+            if( length == 0 )
+                return OverflowPolicy::Underflow();
+            RemoveLast();
+            return true;
+        }
+
+        constexpr void clear() noexcept
+        {
+            while( length > 0 )
+                RemoveLast();
+        }
+
+        friend constexpr bool operator==( const StaticVector& left, const StaticVector& right )
+        {
+            if( left.length != right.length )
+                return false;
+            for( std::size_t index = 0; index < left.length; ++index )
+                if( !(left.elements[index] == right.elements[index]) )
+                    return false;
+            return true;
+        }
+
+        friend constexpr bool operator!=( const StaticVector& left, const StaticVector& right )
+        {
+            return !(left == right);
+        }
+#pragma endregion
+
+#pragma region AddRange
+        /// <summary>
+        /// Adds all elements of the specified collection to the end of the StaticVector, or none of them if they do not fit
+        /// </summary>
+        /// <param name="list">The collection whose elements should be added to the end of the StaticVector</param>
+        /// <returns>true if the elements were added; false if they do not fit and OverflowPolicy did not throw</returns>
+        constexpr bool AddRange( std::initializer_list<T> list )
+        {
+            if( list.size() > N - length )
+                return OverflowPolicy::Overflow();
+            for( const T& item : list )
+                elements[length++] = item;
+            return true;
+        }
+
+        /// <summary>
+        /// Adds all elements of the specified sized collection to the end of the StaticVector, or none of them if they do not fit
+        /// </summary>
+        /// <param name="range">The collection whose elements should be added to the end of the StaticVector</param>
+        /// <returns>true if the elements were added; false if they do not fit and OverflowPolicy did not throw</returns>
+        template<class Range, EnableIfRange<Range, StaticVector> = 0>
+        constexpr bool AddRange( const Range& range )
+        {
+            if( static_cast<std::size_t>(std::size( range )) > N - length )
+                return OverflowPolicy::Overflow();
+            for( const auto& item : range )
+                elements[length++] = item;
+            return true;
+        }
+
+        /// <summary>
+        /// Inserts an element into the StaticVector at the specified index
+        /// </summary>
+        /// <param name="index">The zero-based index at which item should be inserted</param>
+        /// <param name="item">The object to insert</param>
+        /// <returns>true if the object was inserted; false if the StaticVector is full and OverflowPolicy did not throw</returns>
+        constexpr bool Insert( const std::size_t index, const T& item )
+        {
+            if( index > length )
+                throw std::invalid_argument( "insertion index beyond container size" );
+            if( length == N )
+                return OverflowPolicy::Overflow();
+            T value = item;
+            for( std::size_t position = length; position > index; --position )
+                elements[position] = std::move( elements[position - 1] );
+            elements[index] = std::move( value );
+            ++length;
+            return true;
+        }
+#pragma endregion
+
+#pragma region Search
+        /// <summary>
+        /// Determines whether an element is in the StaticVector
+        /// </summary>
+        /// <param name="item">The object to locate in the StaticVector</param>
+        /// <returns>true if item is found in the StaticVector; otherwise false</returns>
+        constexpr bool Contains( const T& item ) const
+        {
+            return IndexOf( item ) >= 0;
+        }
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the first occurrence within the StaticVector
+        /// </summary>
+        /// <param name="item">The object to locate in the StaticVector</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <returns>The zero-based index of the first occurrence of item if found; otherwise -1</returns>
+        constexpr int IndexOf( const T& item, const std::size_t start = 0 ) const
+        {
+            return FindIndex( [&item]( const T& element ) { return element == item; }, start );
+        }
+
+        /// <summary>
+        /// Searches for the specified object and returns the zero-based index of the last occurrence within the StaticVector
+        /// </summary>
+        /// <param name="item">The object to locate in the StaticVector</param>
+        /// <returns>The zero-based index of the last occurrence of item if found; otherwise -1</returns>
+        constexpr int LastIndexOf( const T& item ) const
+        {
+            return FindLastIndex( [&item]( const T& element ) { return element == item; } );
+        }
+
+        /// <summary>
+        /// Determines whether the StaticVector contains elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for</param>
+        /// <returns>true if at least one element matches the conditions; otherwise false</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr bool Exists( Predicate&& predicate ) const
+        {
+            return FindIndex( predicate ) >= 0;
+        }
+
+        /// <summary>
+        /// Determines whether every element in the StaticVector matches the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions to check the elements against</param>
+        /// <returns>true if every element matches the conditions or the StaticVector is empty; otherwise false</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr bool TrueForAll( Predicate&& predicate ) const
+        {
+            return FindIndex( [&predicate]( const T& element ) { return !predicate( element ); } ) < 0;
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate and returns the first occurrence
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for</param>
+        /// <returns>The first element that matches the conditions if found; otherwise the default value of T</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr T Find( Predicate&& predicate ) const
+        {
+            const int index = FindIndex( predicate );
+            return index >= 0 ? elements[index] : T();
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate and returns the last occurrence
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for</param>
+        /// <returns>The last element that matches the conditions if found; otherwise the default value of T</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr T FindLast( Predicate&& predicate ) const
+        {
+            const int index = FindLastIndex( predicate );
+            return index >= 0 ? elements[index] : T();
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate and returns the zero-based index of the first occurrence
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <returns>The zero-based index of the first element that matches the conditions if found; otherwise -1</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr int FindIndex( Predicate&& predicate, const std::size_t start = 0 ) const
+        {
+            for( std::size_t index = start; index < length; ++index )
+                if( predicate( elements[index] ) )
+                    return static_cast<int>(index);
+            return -1;
+        }
+
+        /// <summary>
+        /// Searches for an element that matches the conditions defined by the specified predicate and returns the zero-based index of the last occurrence
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for</param>
+        /// <returns>The zero-based index of the last element that matches the conditions if found; otherwise -1</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr int FindLastIndex( Predicate&& predicate ) const
+        {
+            for( std::size_t index = length; index > 0; --index )
+                if( predicate( elements[index - 1] ) )
+                    return static_cast<int>(index - 1);
+            return -1;
+        }
+
+        /// <summary>
+        /// Retrieves all the elements that match the conditions defined by the specified predicate
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for</param>
+        /// <returns>A StaticVector of the same capacity containing all the matching elements</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr StaticVector FindAll( Predicate&& predicate ) const
+        {
+            StaticVector results;
+            for( std::size_t index = 0; index < length; ++index )
+                if( predicate( elements[index] ) )
+                    results.elements[results.length++] = elements[index];
+            return results;
+        }
+
+        /// <summary>
+        /// Searches the entire sorted StaticVector for an element and returns the zero-based index of the element
+        /// </summary>
+        /// <param name="item">The object to locate</param>
+        /// <returns>The zero-based index of the first occurrence of item if found; otherwise a negative number that is the bitwise complement of the index of the first element larger than item or of size() if there is no larger element</returns>
+        constexpr int BinarySearch( const T& item ) const
+        {
+            std::size_t first = 0;
+            std::size_t remaining = length;
+            while( remaining > 0 )
+            {
+                const std::size_t half = remaining / 2;
+                if( elements[first + half] < item )
+                {
+                    first += half + 1;
+                    remaining -= half + 1;
+                }
+                else
+                    remaining = half;
+            }
+            if( first < length && !(item < elements[first]) )
+                return static_cast<int>(first);
+            return ~static_cast<int>(first);
+        }
+#pragma endregion
+
+#pragma region Transform
+        /// <summary>
+        /// Converts the elements in the StaticVector to another type
+        /// </summary>
+        /// <typeparam name="Tout">The type of the elements of the target StaticVector</typeparam>
+        /// <param name="converter">The callable that converts each element from one type to another type</param>
+        /// <returns>A StaticVector of the same capacity and overflow policy containing the converted elements</returns>
+        template<class Tout, class Converter, EnableIfInvocable<Tout, Converter, const T&> = 0>
+        constexpr StaticVector<Tout, N, OverflowPolicy> ConvertAll( Converter&& converter ) const
+        {
+            StaticVector<Tout, N, OverflowPolicy> converted;
+            for( std::size_t index = 0; index < length; ++index )
+                converted.push_back( converter( elements[index] ) );
+            return converted;
+        }
+
+        /// <summary>
+        /// Performs the specified action on each element of the StaticVector
+        /// </summary>
+        /// <param name="action">The callable to perform on each element</param>
+        template<class Action>
+        constexpr void ForEach( Action&& action )
+        {
+            for( std::size_t index = 0; index < length; ++index )
+                action( elements[index] );
+        }
+
+        /// <summary>
+        /// Reverses the order of the elements in the entire StaticVector
+        /// </summary>
+        constexpr void Reverse() noexcept
+        {
+            ReverseGenericImplementation( 0, length );
+        }
+
+        /// <summary>
+        /// Reverses the order of the elements in the specified range
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the range to reverse</param>
+        /// <param name="count">The number of elements in the range to reverse</param>
+        constexpr void Reverse( const std::size_t start, const std::size_t count )
+        {
+            if( start + count > length )
+                throw std::invalid_argument( "range exceeds the container size" );
+            ReverseGenericImplementation( start, start + count );
+        }
+
+        /// <summary>
+        /// Sorts the elements in ascending order. Uses insertion sort for short StaticVectors and heap sort otherwise, so it is not stable
+        /// </summary>
+        constexpr void Sort()
+        {
+            Sort( []( const T& left, const T& right ) { return left < right; } );
+        }
+
+        /// <summary>
+        /// Sorts the elements using the specified comparer. Uses insertion sort for short StaticVectors and heap sort otherwise, so it is not stable
+        /// </summary>
+        /// <param name="comparer">Callable returning true if its first argument should precede the second one</param>
+        template<class Comparer, EnableIfInvocable<bool, Comparer, const T&, const T&> = 0>
+        constexpr void Sort( Comparer&& comparer )
+        {
+            if( length <= insertionSortThreshold )
+            {
+                for( std::size_t index = 1; index < length; ++index )
+                    for( std::size_t position = index; position > 0 && comparer( elements[position], elements[position - 1] ); --position )
+                        Swap( elements[position], elements[position - 1] );
+                return;
+            }
+            for( std::size_t root = length / 2; root-- > 0; )
+                SiftDownGenericImplementation( root, length, comparer );
+            for( std::size_t end = length; end-- > 1; )
+            {
+                Swap( elements[0], elements[end] );
+                SiftDownGenericImplementation( 0, end, comparer );
+            }
+        }
+#pragma endregion
+
+#pragma region Remove
+        /// <summary>
+        /// Removes the first occurrence of a specific object from the StaticVector
+        /// </summary>
+        /// <param name="item">The object to remove</param>
+        constexpr void Remove( const T& item )
+        {
+            const int index = IndexOf( item );
+            if( index >= 0 )
+                RemoveRangeGenericImplementation( static_cast<std::size_t>(index), 1 );
+        }
+
+        /// <summary>
+        /// Removes the element at the specified index of the StaticVector
+        /// </summary>
+        /// <param name="index">The zero-based index of the element to remove</param>
+        constexpr void RemoveAt( const std::size_t index )
+        {
+            if( index >= length )
+                throw std::invalid_argument( "index to remove exceeds the container size" );
+            RemoveRangeGenericImplementation( index, 1 );
+        }
+
+        /// <summary>
+        /// Removes a range of elements from the StaticVector
+        /// </summary>
+        /// <param name="start">The zero-based starting index of the range of elements to remove</param>
+        /// <param name="count">The number of elements to remove</param>
+        constexpr void RemoveRange( const std::size_t start, const std::size_t count )
+        {
+            if( start + count > length )
+                throw std::invalid_argument( "range exceeds the container size" );
+            RemoveRangeGenericImplementation( start, count );
+        }
+
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate, keeping the order of the remaining elements
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to remove</param>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        constexpr void RemoveAll( Predicate&& predicate )
+        {
+            std::size_t kept = 0;
+            for( std::size_t index = 0; index < length; ++index )
+                if( !predicate( elements[index] ) )
+                {
+                    if( kept != index )
+                        elements[kept] = std::move( elements[index] );
+                    ++kept;
+                }
+            while( length > kept )
+                RemoveLast();
+        }
+#pragma endregion
+
+    private:
+        static constexpr std::size_t insertionSortThreshold = 16;
+
+        std::array<T, N> elements{};
+        std::size_t length = 0;
+
+        constexpr void RemoveLast() noexcept
+        {
+            elements[--length] = T();
+        }
+
+        static constexpr void Swap( T& left, T& right )
+        {
+            T temporary = std::move( left );
+            left = std::move( right );
+            right = std::move( temporary );
+        }
+
+        constexpr void ReverseGenericImplementation( std::size_t first, std::size_t last )
+        {
+            while( first + 1 < last )
+                Swap( elements[first++], elements[--last] );
+        }
+
+        constexpr void RemoveRangeGenericImplementation( const std::size_t start, const std::size_t removed )
+        {
+            for( std::size_t index = start; index + removed < length; ++index )
+                elements[index] = std::move( elements[index + removed] );
+            for( std::size_t index = 0; index < removed; ++index )
+                RemoveLast();
+        }
+
+        template<class Comparer>
+        constexpr void SiftDownGenericImplementation( std::size_t root, const std::size_t heapSize, Comparer& comparer )
+        {
+            while( 2 * root + 1 < heapSize )
+            {
+                std::size_t child = 2 * root + 1;
+                if( child + 1 < heapSize && comparer( elements[child], elements[child + 1] ) )
+                    ++child;
+                if( !comparer( elements[root], elements[child] ) )
+                    return;
+                Swap( elements[root], elements[child] );
+                root = child;
+            }
+        }
+    };
+
+
+    /// <summary>
+    /// Returns the default number of elements in one chunk of ChunkedVector: the smallest power of two of at least 128 elements which take at least 64 KiB.
+    /// Allocating a chunk for fewer than one append in a hundred keeps the allocations out of the 99th percentile of the append latency
+    /// </summary>
+    template<class T>
+    constexpr std::size_t DefaultChunkSize() noexcept
+    {
+        std::size_t size = 128;
+        while( size * sizeof( T ) < 65536 )
+            size *= 2;
+        return size;
+    }
+
+    /// <summary>
+    /// Vector which stores its elements in separately allocated chunks of ChunkSize elements, addressed through a table of chunk pointers.
+    /// Growing allocates a new chunk and never moves the elements already stored, so appending has no reallocation copies
+    /// and the references, pointers and iterators to the elements stay valid until the elements themselves are removed.
+    /// Indexed access is O(1): the index is split by a shift and a mask into the chunk and the position inside of it
+    /// </summary>
+    template<class T, std::size_t ChunkSize = DefaultChunkSize<T>(), class Allocator = std::allocator<T>>
+    class ChunkedVector
+    {
+        static_assert( ChunkSize > 0 && (ChunkSize & (ChunkSize - 1)) == 0, "ChunkedVector requires a power of two ChunkSize" );
+
+        using AllocatorTraits = std::allocator_traits<Allocator>;
+        using ChunkTable = std::vector<T*, typename AllocatorTraits::template rebind_alloc<T*>>;
+
+        template<bool IsConst>
+        class ChunkIterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = T;
+            using difference_type = std::ptrdiff_t;
+            using pointer = std::conditional_t<IsConst, const T*, T*>;
+            using reference = std::conditional_t<IsConst, const T&, T&>;
+
+            ChunkIterator() noexcept = default;
+
+            ChunkIterator( const ChunkTable* chunks, const std::size_t index ) noexcept : chunks( chunks ), index( index )
+            {
+            }
+
+            operator ChunkIterator<true>() const noexcept
+            {
+                return ChunkIterator<true>( chunks, index );
+            }
+
+            reference operator*() const noexcept { return (*chunks)[index >> chunkShift][index & chunkMask]; }
+            pointer operator->() const noexcept { return &**this; }
+            reference operator[]( const difference_type offset ) const noexcept { return *(*this + offset); }
+
+            ChunkIterator& operator++() noexcept { ++index; return *this; }
+            ChunkIterator& operator--() noexcept { --index; return *this; }
+            ChunkIterator operator++( int ) noexcept { auto previous = *this; ++index; return previous; }
+            ChunkIterator operator--( int ) noexcept { auto previous = *this; --index; return previous; }
+            ChunkIterator& operator+=( const difference_type offset ) noexcept { index += offset; return *this; }
+            ChunkIterator& operator-=( const difference_type offset ) noexcept { index -= offset; return *this; }
+
+            friend ChunkIterator operator+( ChunkIterator iterator, const difference_type offset ) noexcept { return iterator += offset; }
+            friend ChunkIterator operator+( const difference_type offset, ChunkIterator iterator ) noexcept { return iterator += offset; }
+            friend ChunkIterator operator-( ChunkIterator iterator, const difference_type offset ) noexcept { return iterator -= offset; }
+            friend difference_type operator-( const ChunkIterator& left, const ChunkIterator& right ) noexcept
+            {
+                return static_cast<difference_type>(left.index) - static_cast<difference_type>(right.index);
+            }
+
+            friend bool operator==( const ChunkIterator& left, const ChunkIterator& right ) noexcept { return left.index == right.index; }
+            friend bool operator!=( const ChunkIterator& left, const ChunkIterator& right ) noexcept { return left.index != right.index; }
+            friend bool operator<( const ChunkIterator& left, const ChunkIterator& right ) noexcept { return left.index < right.index; }
+            friend bool operator>( const ChunkIterator& left, const ChunkIterator& right ) noexcept { return left.index > right.index; }
+            friend bool operator<=( const ChunkIterator& left, const ChunkIterator& right ) noexcept { return left.index <= right.index; }
+            friend bool operator>=( const ChunkIterator& left, const ChunkIterator& right ) noexcept { return left.index >= right.index; }
+
+        private:
+            const ChunkTable* chunks = nullptr;
+            std::size_t index = 0;
+        };
+
+    public:
+        using value_type = T;
+        using allocator_type = Allocator;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = ChunkIterator<false>;
+        using const_iterator = ChunkIterator<true>;
+
+#pragma region Constructors
+        ChunkedVector() noexcept( noexcept(Allocator()) ) : ChunkedVector( Allocator() )
+        {
+        }
+
+        explicit ChunkedVector( const Allocator& allocator ) noexcept : allocator( allocator ), chunks( typename ChunkTable::allocator_type( allocator ) )
+        {
+        }
+
+        ChunkedVector( std::initializer_list<T> initialValues, const Allocator& allocator = Allocator() ) : ChunkedVector( allocator )
+        {
+            AddRange( initialValues );
+        }
+
+        ChunkedVector( const ChunkedVector& other ) : ChunkedVector( AllocatorTraits::select_on_container_copy_construction( other.allocator ) )
+        {
+            AddRange( other );
+        }
+
+        ChunkedVector( ChunkedVector&& other ) noexcept : allocator( std::move( other.allocator ) ), chunks( std::move( other.chunks ) ), length( other.length )
+        {
+            other.chunks.clear();
+            other.length = 0;
+        }
+
+        ChunkedVector& operator=( const ChunkedVector& other )
+        {
+            if( this == &other )
+                return *this;
+            clear();
+            if constexpr( AllocatorTraits::propagate_on_container_copy_assignment::value )
+            {
+                if( allocator != other.allocator )
+                {
+                    ReleaseChunks();
+                    allocator = other.allocator;
+                    chunks = ChunkTable( typename ChunkTable::allocator_type( allocator ) );
+                }
+            }
+            AddRange( other );
+            return *this;
+        }
+
+        ChunkedVector& operator=( ChunkedVector&& other ) noexcept( AllocatorTraits::propagate_on_container_move_assignment::value || AllocatorTraits::is_always_equal::value )
+        {
+            if( this == &other )
+                return *this;
+            if( !AllocatorTraits::propagate_on_container_move_assignment::value && allocator != other.allocator )
+            {
+                clear();
+                AddRange( std::make_move_iterator( other.begin() ), std::make_move_iterator( other.end() ) );
+                other.clear();
+                return *this;
+            }
+            clear();
+            ReleaseChunks();
+            if constexpr( AllocatorTraits::propagate_on_container_move_assignment::value )
+                allocator = std::move( other.allocator );
+            chunks = std::move( other.chunks );
+            length = other.length;
+            other.chunks.clear();
+            other.length = 0;
+            return *this;
+        }
+
+        ~ChunkedVector()
+        {
+            clear();
+            ReleaseChunks();
+        }
+#pragma endregion
+
+#pragma region Storage
+        allocator_type get_allocator() const noexcept { return allocator; }
+        std::size_t size() const noexcept { return length; }
+        bool empty() const noexcept { return length == 0; }
+        std::size_t capacity() const noexcept { return chunks.size() * ChunkSize; }
+        static constexpr std::size_t chunk_size() noexcept { return ChunkSize; }
+
+        iterator begin() noexcept { return iterator( &chunks, 0 ); }
+        iterator end() noexcept { return iterator( &chunks, length ); }
+        const_iterator begin() const noexcept { return const_iterator( &chunks, 0 ); }
+        const_iterator end() const noexcept { return const_iterator( &chunks, length ); }
+        const_iterator cbegin() const noexcept { return begin(); }
+        const_iterator cend() const noexcept { return end(); }
+
+        T& operator[]( const std::size_t index ) noexcept { return chunks[index >> chunkShift][index & chunkMask]; }
+        const T& operator[]( const std::size_t index ) const noexcept { return chunks[index >> chunkShift][index & chunkMask]; }
+        T& front() noexcept { return (*this)[0]; }
+        const T& front() const noexcept { return (*this)[0]; }
+        T& back() noexcept { return (*this)[length - 1]; }
+        const T& back() const noexcept { return (*this)[length - 1]; }
+
+        T& at( const std::size_t index )
+        {
+            if( index >= length )
+                throw std::out_of_range( "index exceeds the size of ChunkedVector" );
+            return (*this)[index];
+        }
+
+        const T& at( const std::size_t index ) const
+        {
+            if( index >= length )
+                throw std::out_of_range( "index exceeds the size of ChunkedVector" );
+            return (*this)[index];
+        }
+
+        void push_back( const T& item )
+        {
+            emplace_back( item );
+        }
+
+        void push_back( T&& item )
+        {
+            emplace_back( std::move( item ) );
+        }
+
+        /// <summary>
+        /// Constructs an element at the end of the ChunkedVector, allocating a new chunk if the last one is full.
+        /// None of the existing elements is moved, so the arguments may refer to the elements of this ChunkedVector
+        /// </summary>
+        /// <returns>The reference to the constructed element</returns>
+        template<class... Arguments>
+        T& emplace_back( Arguments&&... arguments )
+        {
+            if( length == capacity() )
+                AddChunk();
+            T* slot = &(*this)[length];
+            AllocatorTraits::construct( allocator, slot, std::forward<Arguments>( arguments )... );
+            ++length;
+            return *slot;
+        }
+
+        void pop_back() noexcept
+        {
+            --length;
+            AllocatorTraits::destroy( allocator, &(*this)[length] );
+        }
+
+        /// <summary>
+        /// Destroys all the elements, keeping the chunks allocated for the elements added later
+        /// </summary>
+        void clear() noexcept
+        {
+            while( length > 0 )
+                pop_back();
+        }
+
+        /// <summary>
+        /// Allocates the chunks needed to hold at least the specified number of elements
+        /// </summary>
+        void reserve( const std::size_t count )
+        {
+            while( capacity() < count )
+                AddChunk();
+        }
+
+        /// <summary>
+        /// Releases the chunks which do not hold any element
+        /// </summary>
+        void shrink_to_fit()
+        {
+            const std::size_t used = (length + ChunkSize - 1) >> chunkShift;
+            while( chunks.size() > used )
+            {
+                AllocatorTraits::deallocate( allocator, chunks.back(), ChunkSize );
+                chunks.pop_back();
+            }
+            chunks.shrink_to_fit();
+        }
+
+        void swap( ChunkedVector& other ) noexcept
+        {
+            if constexpr( AllocatorTraits::propagate_on_container_swap::value )
+                std::swap( allocator, other.allocator );
+            chunks.swap( other.chunks );
+            std::swap( length, other.length );
+        }
+
+        friend bool operator==( const ChunkedVector& left, const ChunkedVector& right )
+        {
+            return left.length == right.length && std::equal( left.begin(), left.end(), right.begin() );
+        }
+
+        friend bool operator!=( const ChunkedVector& left, const ChunkedVector& right )
+        {
+            return !(left == right);
+        }
+#pragma endregion
+
+#pragma region AddRange
+        /// <summary>
+        /// Adds the elements of the specified collection to the end of the ChunkedVector
         /// </summary>
-        /// <param name="start">The zero-based index in Vector at which the range starts</param>
-        /// <param name="end">The zero-based index in Vector at which the range ends</param>
-        /// <returns>A shallow copy of a range of elements in the source Vector</returns>
-        Vector<T> GetRange( const unsigned int start, const unsigned int end ) const
+        /// <param name="list">The collection whose elements should be added to the end of the ChunkedVector</param>
+        void AddRange( std::initializer_list<T> list )
         {
-            if( start >= this->size() || end >= this->size() || start >= end )
-                throw std::invalid_argument( "Incorrect range tresholds were given" );
-            Vector<T> newVector;
-            for( auto it = this->cbegin() + start; it != this->cbegin() + end; ++it )
-                newVector.push_back( *it );
-            return newVector;
+            AddRange( list.begin(), list.end() );
+        }
+
+        /// <summary>
+        /// Adds the elements in the specified iterator range to the end of the ChunkedVector, allocating the needed chunks up front when the size of the range is known
+        /// </summary>
+        /// <param name="first">The iterator to the first element to add</param>
+        /// <param name="last">The iterator past the last element to add</param>
+        template<class InputIterator, class = typename std::iterator_traits<InputIterator>::iterator_category>
+        void AddRange( InputIterator first, InputIterator last )
+        {
+            if constexpr( std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIterator>::iterator_category> )
+                reserve( length + static_cast<std::size_t>(std::distance( first, last )) );
+            for( ; first != last; ++first )
+                emplace_back( *first );
+        }
+
+        /// <summary>
+        /// Adds the elements of the specified collection to the end of the ChunkedVector, moving them out of the collection if it is an rvalue
+        /// </summary>
+        /// <param name="range">The collection whose elements should be added to the end of the ChunkedVector</param>
+        template<class Range, EnableIfRange<Range, void> = 0>
+        void AddRange( Range&& range )
+        {
+            if constexpr( std::is_rvalue_reference_v<Range&&> && !std::is_const_v<std::remove_reference_t<Range>> )
+                AddRange( std::make_move_iterator( std::begin( range ) ), std::make_move_iterator( std::end( range ) ) );
+            else
+                AddRange( std::begin( range ), std::end( range ) );
         }
 #pragma endregion
 
-#pragma region LastIndexOf
+#pragma region FindAll
         /// <summary>
-        /// Searches for the specified object within the entire Vector
+        /// Retrieve all the elements that match the conditions defined by the specified predicate
         /// </summary>
-        /// <param name="item">The object to locate in the Vector. The value is not checked against nullptr</param>
-        /// <returns>The zero-based index of the last occurrence of item within the entire Vector if found; -1 otherwise</returns>
-        const int LastIndexOf( T item ) const noexcept
+        /// <param name="predicate">The std::function predicate that defines the conditions of the elements to search for</param>
+        /// <returns>A ChunkedVector containing all the elements that match the conditions defined by the specified predicate if any is found; empty ChunkedVector otherwise</returns>
+        ChunkedVector FindAll( std::function<bool( const T& )> predicate ) const
         {
-            return LastIndexOfGenericImplementation( item, 0, this->size() );
+            return FindAll<std::function<bool( const T& )>&>( predicate );
         }
 
         /// <summary>
-        /// Searches for the specified object within the range of elements in the Vector. The range starts at position index and ends at the last element of Vector
+        /// Retrieve all the elements that match the conditions defined by the specified predicate
         /// </summary>
-        /// <param name="item">The object to locate in the Vector. The value is not checked against nullpts</param>
-        /// <param name="index">The zero-based starting index of the range to search</param>
-        /// <returns>The zero-based index of the last occurrence of item within the range of elements in the Vector</returns>
-        const int LastIndexOf( T item, const unsigned int index )
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for, invoked directly so that it can be inlined</param>
+        /// <returns>A ChunkedVector containing all the elements that match the conditions defined by the specified predicate if any is found; empty ChunkedVector otherwise</returns>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        ChunkedVector FindAll( Predicate&& predicate ) const
         {
-            return LastIndexOfGenericImplementation( item, 0, index );
+            ChunkedVector results( ResultAllocator() );
+            ForEachChunkGenericImplementation( [&]( const T* first, const T* last )
+                {
+                    for( ; first != last; ++first )
+                        if( predicate( *first ) )
+                            results.push_back( *first );
+                } );
+            return results;
         }
+#pragma endregion
 
+#pragma region ForEach
         /// <summary>
-        /// Searches for the specified object within the range of elements in the Vector. The range starts at position index and comprises the number of elements given as count parameter.
+        /// Performes the specified action on each element of the ChunkedVector
         /// </summary>
-        /// <param name="item">The object to locate in the Vector</param>
-        /// <param name="index">The zero-based starting index of the search</param>
-        /// <param name="count">The number of elements in the search range</param>
-        /// <returns>The zero-based index of the last occurrence within the specified range of elements in the Vector if found; -1 otherwise</returns>
-        const int LastIndexOf( T item, const unsigned int index, const unsigned int count )
+        /// <param name="action">The std::function delegate to perform on each element of the ChunkedVector</param>
+        void ForEach( std::function<void( T& )> action )
         {
-            return LastIndexOfGenericImplementation( item, index, count );
+            ForEach<std::function<void( T& )>&>( action );
+        }
+
+        /// <summary>
+        /// Performes the specified action on each element of the ChunkedVector, walking every chunk as a contiguous array
+        /// </summary>
+        /// <param name="action">The callable to perform on each element of the ChunkedVector, invoked directly so that it can be inlined</param>
+        template<class Action, EnableIfInvocable<void, Action, T&> = 0>
+        void ForEach( Action&& action )
+        {
+            ForEachChunkGenericImplementation( [&]( T* first, T* last )
+                {
+                    for( ; first != last; ++first )
+                        action( *first );
+                } );
         }
 #pragma endregion
 
-#pragma region ConvertAll
+#pragma region RemoveAll
         /// <summary>
-        /// Converts the elements in the current Vector to another type and returns a Vector containing the converted elements
+        /// Removes all the elements that match the conditions defined by the specified predicate.
+        /// The remaining elements keep their order and are moved towards the front, so only the references to the elements before the first removed one stay valid
         /// </summary>
-        /// <typeparam name="Tout">The type of the elements of the target array</typeparam>
-        /// <param name="converter">A std::function delegate that converts each element from one type to another type</param>
-        /// <returns>A Vector of the target type containing the converted elements from the current Vector</returns>
-        template<class Tout> Vector<Tout> ConvertAll( std::function<Tout( T )> converter ) const noexcept
+        /// <param name="predicate">The std::function delegate that defines the conditions of the elements to remove</param>
+        void RemoveAll( std::function<bool( const T& )> predicate )
         {
-            Vector<Tout> convertedContainer;
-            for( auto it = this->cbegin(); it != this->cend(); ++it )
-                convertedContainer.push_back( converter( *it ) );
-            return convertedContainer;
+            RemoveAll<std::function<bool( const T& )>&>( predicate );
+        }
+
+        /// <summary>
+        /// Removes all the elements that match the conditions defined by the specified predicate.
+        /// The remaining elements keep their order and are moved towards the front, so only the references to the elements before the first removed one stay valid
+        /// </summary>
+        /// <param name="predicate">The callable that defines the conditions of the elements to remove, invoked directly so that it can be inlined</param>
+        template<class Predicate, EnableIfInvocable<bool, Predicate, const T&> = 0>
+        void RemoveAll( Predicate&& predicate )
+        {
+            const std::size_t kept = static_cast<std::size_t>(std::remove_if( begin(), end(), predicate ) - begin());
+            while( length > kept )
+                pop_back();
         }
 #pragma endregion
 
-#pragma region RemoveAt
+    private:
+        static constexpr std::size_t chunkShift = [](){ std::size_t shift = 0; while( (std::size_t( 1 ) << shift) < ChunkSize ) ++shift; return shift; }();
+        static constexpr std::size_t chunkMask = ChunkSize - 1;
+
+        Allocator allocator;
+        ChunkTable chunks;
+        std::size_t length = 0;
+
+        void AddChunk()
+        {
+            chunks.reserve( chunks.size() + 1 );
+            chunks.push_back( AllocatorTraits::allocate( allocator, ChunkSize ) );
+        }
+
+        Allocator ResultAllocator() const
+        {
+            if constexpr( SharesAllocatorWithResults<Allocator>::value )
+                return allocator;
+            else
+                return AllocatorTraits::select_on_container_copy_construction( allocator );
+        }
+
+        void ReleaseChunks() noexcept
+        {
+            for( T* chunk : chunks )
+                AllocatorTraits::deallocate( allocator, chunk, ChunkSize );
+            chunks.clear();
+        }
+
         /// <summary>
-        /// Removes the element at specified index of the Vector
+        /// Calls the visitor with the bounds of the elements stored in every chunk in turn
         /// </summary>
-        /// <param name="index">The zero-based index of the element to remove</param>
-        void RemoveAt( const unsigned int index )
+        template<class Visitor>
+        void ForEachChunkGenericImplementation( Visitor&& visitor ) const
         {
-            if( index >= this->size() )
-                throw std::invalid_argument( "index to remove exceeds the container size" );
-            this->erase( this->cbegin() + index );
+            for( std::size_t start = 0; start < length; start += ChunkSize )
+            {
+                T* first = chunks[start >> chunkShift];
+                visitor( first, first + std::min( ChunkSize, length - start ) );
+            }
+        }
+    };
+
+    /// <summary>
+    /// Vector of records stored as a structure of arrays: every field of the records lives in its own contiguous column (a Vector of that field).
+    /// A scan which reads only some of the fields, such as FindAll or FindIndex on the listed columns, touches only the memory of those columns.
+    /// The elements are accessed through proxies whose Get&lt;Column&gt;() returns the reference to one field, and which convert to std::tuple or, with As&lt;Record&gt;(), to any record constructible from the fields
+    /// </summary>
+    template<class... Fields>
+    class SoAVector
+    {
+        static_assert( sizeof...(Fields) > 0, "SoAVector requires at least one field" );
+
+        template<std::size_t Column>
+        using FieldType = std::tuple_element_t<Column, std::tuple<Fields...>>;
+
+        template<bool IsConst>
+        class RowReference
+        {
+            using Owner = std::conditional_t<IsConst, const SoAVector, SoAVector>;
+
+        public:
+            RowReference( Owner& owner, const std::size_t index ) noexcept : owner( &owner ), index( index )
+            {
+            }
+
+            RowReference( const RowReference& other ) noexcept = default;
+
+            operator RowReference<true>() const noexcept
+            {
+                return RowReference<true>( *owner, index );
+            }
+
+            /// <summary>
+            /// Returns the reference to the specified field of the element
+            /// </summary>
+            template<std::size_t Column>
+            decltype(auto) Get() const noexcept
+            {
+                return std::get<Column>( owner->columns )[index];
+            }
+
+            /// <summary>
+            /// Creates a Record from the fields of the element, passed to its constructor in the order of the columns
+            /// </summary>
+            template<class Record>
+            Record As() const
+            {
+                return AsGenericImplementation<Record>( std::index_sequence_for<Fields...>() );
+            }
+
+            operator std::tuple<Fields...>() const
+            {
+                return As<std::tuple<Fields...>>();
+            }
+
+            /// <summary>
+            /// Assigns the fields of the element from the specified values
+            /// </summary>
+            const RowReference& operator=( const std::tuple<Fields...>& values ) const
+            {
+                static_assert( !IsConst, "The element of a const SoAVector cannot be assigned" );
+                AssignGenericImplementation( values, std::index_sequence_for<Fields...>() );
+                return *this;
+            }
+
+            const RowReference& operator=( const RowReference& other ) const
+            {
+                return *this = other.template As<std::tuple<Fields...>>();
+            }
+
+        private:
+            Owner* owner;
+            std::size_t index;
+
+            template<class Record, std::size_t... Columns>
+            Record AsGenericImplementation( std::index_sequence<Columns...> ) const
+            {
+                return Record( std::get<Columns>( owner->columns )[index]... );
+            }
+
+            template<std::size_t... Columns>
+            void AssignGenericImplementation( const std::tuple<Fields...>& values, std::index_sequence<Columns...> ) const
+            {
+                ((std::get<Columns>( owner->columns )[index] = std::get<Columns>( values )), ...);
+            }
+        };
+
+        template<bool IsConst>
+        class RowIterator
+        {
+            using Owner = std::conditional_t<IsConst, const SoAVector, SoAVector>;
+
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = std::tuple<Fields...>;
+            using difference_type = std::ptrdiff_t;
+            using pointer = void;
+            using reference = RowReference<IsConst>;
+
+            RowIterator( Owner& owner, const std::size_t index ) noexcept : owner( &owner ), index( index )
+            {
+            }
+
+            reference operator*() const noexcept { return reference( *owner, index ); }
+            RowIterator& operator++() noexcept { ++index; return *this; }
+            RowIterator operator++( int ) noexcept { auto previous = *this; ++index; return previous; }
+
+            friend bool operator==( const RowIterator& left, const RowIterator& right ) noexcept { return left.index == right.index; }
+            friend bool operator!=( const RowIterator& left, const RowIterator& right ) noexcept { return left.index != right.index; }
+
+        private:
+            Owner* owner;
+            std::size_t index;
+        };
+
+    public:
+        using value_type = std::tuple<Fields...>;
+        using size_type = std::size_t;
+        using reference = RowReference<false>;
+        using const_reference = RowReference<true>;
+        using iterator = RowIterator<false>;
+        using const_iterator = RowIterator<true>;
+
+#pragma region Constructors
+        SoAVector() = default;
+
+        SoAVector( std::initializer_list<std::tuple<Fields...>> initialValues )
+        {
+            AddRange( initialValues );
         }
 #pragma endregion
 
-#pragma region ForEach
+#pragma region Storage
+        std::size_t size() const noexcept { return std::get<0>( columns ).size(); }
+        bool empty() const noexcept { return std::get<0>( columns ).empty(); }
+
+        iterator begin() noexcept { return iterator( *this, 0 ); }
+        iterator end() noexcept { return iterator( *this, size() ); }
+        const_iterator begin() const noexcept { return const_iterator( *this, 0 ); }
+        const_iterator end() const noexcept { return const_iterator( *this, size() ); }
+
+        reference operator[]( const std::size_t index ) noexcept { return reference( *this, index ); }
+        const_reference operator[]( const std::size_t index ) const noexcept { return const_reference( *this, index ); }
+
+        reference at( const std::size_t index )
+        {
+            if( index >= size() )
+                throw std::out_of_range( "index exceeds the size of SoAVector" );
+            return reference( *this, index );
+        }
+
+        const_reference at( const std::size_t index ) const
+        {
+            if( index >= size() )
+                throw std::out_of_range( "index exceeds the size of SoAVector" );
+            return const_reference( *this, index );
+        }
+
         /// <summary>
-        /// Performes the specified action on each element of the Vector
+        /// Gives the read-only access to the contiguous column of the specified field
         /// </summary>
-        /// <param name="action">The std::function delegate to perform on each element of the Vector</param>
-        /// <returns></returns>
-        void ForEach( std::function<void( T& )> action ) noexcept
+        /// <returns>The Vector holding the specified field of all the elements</returns>
+        template<std::size_t Column>
+        const Vector<FieldType<Column>>& GetColumn() const noexcept
         {
-            for( T& element : *this )
-                action( element );
+            return std::get<Column>( columns );
+        }
+
+        void push_back( const std::tuple<Fields...>& values )
+        {
+            std::apply( [this]( const Fields&... fields ) { emplace_back( fields... ); }, values );
+        }
+
+        void push_back( std::tuple<Fields...>&& values )
+        {
+            std::apply( [this]( Fields&... fields ) { emplace_back( std::move( fields )... ); }, values );
+        }
+
+        /// <summary>
+        /// Adds an element built from the specified fields, one for every column.
+        /// If adding any of the fields throws, the fields already added are removed, so the columns keep the same size
+        /// </summary>
+        template<class... Arguments, std::enable_if_t<sizeof...(Arguments) == sizeof...(Fields), int> = 0>
+        void emplace_back( Arguments&&... fields )
+        {
+            EmplaceBackGenericImplementation( std::index_sequence_for<Fields...>(), std::forward<Arguments>( fields )... );
+        }
+
+        void pop_back() noexcept
+        {
+            std::apply( []( auto&... column ) { (column.pop_back(), ...); }, columns );
+        }
+
+        void clear() noexcept
+        {
+            std::apply( []( auto&... column ) { (column.clear(), ...); }, columns );
+        }
+
+        void reserve( const std::size_t capacity )
+        {
+            std::apply( [capacity]( auto&... column ) { (column.reserve( capacity ), ...); }, columns );
+        }
+
+        friend bool operator==( const SoAVector& left, const SoAVector& right )
+        {
+            return left.columns == right.columns;
+        }
+
+        friend bool operator!=( const SoAVector& left, const SoAVector& right )
+        {
+            return !(left == right);
+        }
+#pragma endregion
+
+#pragma region AddRange
+        /// <summary>
+        /// Adds the records of the specified collection to the end of the SoAVector, splitting every record into its fields
+        /// </summary>
+        /// <param name="range">The collection of std::tuple, std::pair or std::array records with a field for every column</param>
+        template<class Range, EnableIfRange<Range, SoAVector> = 0>
+        void AddRange( const Range& range )
+        {
+            for( const auto& record : range )
+                std::apply( [this]( const auto&... fields ) { emplace_back( fields... ); }, record );
+        }
+
+        /// <summary>
+        /// Adds the records of the specified collection to the end of the SoAVector, splitting every record into its fields with the specified projection
+        /// </summary>
+        /// <param name="range">The collection of records to add</param>
+        /// <param name="projection">The callable which returns the std::tuple of the fields of a record, one for every column</param>
+        template<class Range, class Projection, EnableIfRange<Range, SoAVector> = 0>
+        void AddRange( const Range& range, Projection&& projection )
+        {
+            for( const auto& record : range )
+                std::apply( [this]( auto&&... fields ) { emplace_back( std::forward<decltype(fields)>( fields )... ); }, projection( record ) );
         }
 #pragma endregion
 
 #pragma region FindAll
         /// <summary>
-        /// Retrieve all the elements that match the conditions defined by the specified predicate
+        /// Retrieve all the elements whose specified fields match the conditions defined by the specified predicate.
+        /// Only the listed columns are read to find the elements, and the other columns are read only for the elements found
         /// </summary>
-        /// <param name="predicate">The std::function predicate that defines the conditions of the elements to search for</param>
-        /// <returns>A Vector containing all the elements that match the conditions defined by the specified predicate if any is found; empty Vector otherwise</returns>
-        Vector<T> FindAll( std::function<bool( T )> predicate ) const noexcept
+        /// <typeparam name="Columns">The indices of the fields passed to the predicate, in the order of its parameters</typeparam>
+        /// <param name="predicate">The callable that defines the conditions of the elements to search for, invoked with the const references to the listed fields</param>
+        /// <returns>A SoAVector containing all the elements that match the conditions defined by the specified predicate if any is found; empty SoAVector otherwise</returns>
+        template<std::size_t... Columns, class Predicate, EnableIfInvocable<bool, Predicate, const FieldType<Columns>&...> = 0>
+        SoAVector FindAll( Predicate&& predicate ) const
         {
-            Vector<T> results;
-            for( auto element : *this )
-                if( predicate( element ) )
-                    results.push_back( element );
+            static_assert( sizeof...(Columns) > 0, "FindAll requires the columns passed to the predicate" );
+            std::vector<std::size_t> matches;
+            const std::size_t count = size();
+            for( std::size_t index = 0; index < count; ++index )
+                if( predicate( std::get<Columns>( columns )[index]... ) )
+                    matches.push_back( index );
+            SoAVector results;
+            GatherGenericImplementation( results, matches, std::index_sequence_for<Fields...>() );
             return results;
         }
 #pragma endregion
 
+#pragma region FindIndex
+        /// <summary>
+        /// Searches for the first element whose specified fields match the conditions defined by the specified predicate, reading only the listed columns
+        /// </summary>
+        /// <typeparam name="Columns">The indices of the fields passed to the predicate, in the order of its parameters</typeparam>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked with the const references to the listed fields</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate, if found; otherwise, -1</returns>
+        template<std::size_t... Columns, class Predicate, EnableIfInvocable<bool, Predicate, const FieldType<Columns>&...> = 0>
+        const int FindIndex( Predicate&& predicate ) const
+        {
+            return FindIndex<Columns...>( predicate, 0 );
+        }
 
-    private:
-        const int BinarySearchGenericImplementation( T item, std::function<bool( T )> predicate, const unsigned int start, const unsigned int count )
+        /// <summary>
+        /// Searches for the first element, starting at the specified index, whose specified fields match the conditions defined by the specified predicate, reading only the listed columns
+        /// </summary>
+        /// <typeparam name="Columns">The indices of the fields passed to the predicate, in the order of its parameters</typeparam>
+        /// <param name="predicate">The callable that defines the conditions of the element to search for, invoked with the const references to the listed fields</param>
+        /// <param name="start">The zero-based starting index of the search</param>
+        /// <returns>The zero-based index of the first occurrence of an element that matches the conditions defined by predicate, if found; otherwise, -1</returns>
+        template<std::size_t... Columns, class Predicate, EnableIfInvocable<bool, Predicate, const FieldType<Columns>&...> = 0>
+        const int FindIndex( Predicate&& predicate, const unsigned int start ) const
         {
-            constexpr int notFoundResult = -1;
-            unsigned int leftIndex = start;
-            unsigned int rightIndex = start + count >= this->size() ? this->size() - 1 : start + count;
+            static_assert( sizeof...(Columns) > 0, "FindIndex requires the columns passed to the predicate" );
+            if( start > size() )
+                throw std::invalid_argument( "start exceeds the size of SoAVector" );
+            const std::size_t count = size();
+            for( std::size_t index = start; index < count; ++index )
+                if( predicate( std::get<Columns>( columns )[index]... ) )
+                    return static_cast<int>(index);
+            return -1;
+        }
+#pragma endregion
 
-            while( leftIndex <= rightIndex )
+#pragma region Sort
+        /// <summary>
+        /// Sorts the elements in ascending order of the specified field.
+        /// Integral and floating-point fields are ordered with the radix sort of Vector::SortByKey, which keeps the order of the elements with equal keys
+        /// </summary>
+        /// <typeparam name="Column">The index of the field to sort by</typeparam>
+        template<std::size_t Column>
+        void Sort()
+        {
+            if constexpr( IsRadixSortable<FieldType<Column>>::value )
             {
-                auto middle = (rightIndex - leftIndex) / 2 + leftIndex;
-                if( predicate( this->at( middle ) ) )
-                    return middle;
-                else if( item < this->at( middle ) )
-                    rightIndex = middle - 1;
-                else if( item > this->at( middle ) )
-                    leftIndex = middle + 1;
+                const auto& keys = std::get<Column>( columns );
+                Vector<std::size_t> order;
+                order.reserve( size() );
+                for( std::size_t index = 0; index < size(); ++index )
+                    order.push_back( index );
+                order.SortByKey( [&keys]( const std::size_t index ) { return keys[index]; } );
+                std::apply( [&order]( auto&... column ) { (PermuteGenericImplementation( column, order ), ...); }, columns );
             }
-            return notFoundResult;
+            else
+                Sort<Column>( std::less<FieldType<Column>>() );
         }
 
+        /// <summary>
+        /// Sorts the elements by the specified field using the specified comparer.
+        /// The order is computed from the key column alone, paired with the positions of the elements when the key is trivially copyable, and then every column is rearranged once
+        /// </summary>
+        /// <typeparam name="Column">The index of the field to sort by</typeparam>
+        /// <param name="comparer">The callable which returns true if its first key should be placed before the second one</param>
+        template<std::size_t Column, class Comparer, EnableIfInvocable<bool, Comparer, const FieldType<Column>&, const FieldType<Column>&> = 0>
+        void Sort( Comparer&& comparer )
+        {
+            using Key = FieldType<Column>;
+            const auto& keys = std::get<Column>( columns );
+            std::vector<std::size_t> order( size() );
+            if constexpr( std::is_trivially_copyable_v<Key> && !std::is_same_v<Key, bool> )
+            {
+                std::vector<std::pair<Key, std::size_t>> pairs( size() );
+                for( std::size_t index = 0; index < pairs.size(); ++index )
+                    pairs[index] = { keys[index], index };
+                std::sort( pairs.begin(), pairs.end(), [&comparer]( const auto& left, const auto& right ) { return comparer( left.first, right.first ); } );
+                for( std::size_t index = 0; index < pairs.size(); ++index )
+                    order[index] = pairs[index].second;
+            }
+            else
+            {
+                for( std::size_t index = 0; index < order.size(); ++index )
+                    order[index] = index;
+                std::sort( order.begin(), order.end(), [&]( const std::size_t left, const std::size_t right ) { return comparer( keys[left], keys[right] ); } );
+            }
+            std::apply( [&order]( auto&... column ) { (PermuteGenericImplementation( column, order ), ...); }, columns );
+        }
+#pragma endregion
 
-        const int IndexOfGenericImplementation( T item, const unsigned int start, const unsigned int count ) const
+#pragma region ToVector
+        /// <summary>
+        /// Creates a Vector of records from the elements, passing the fields of every element to the constructor of Record in the order of the columns
+        /// </summary>
+        /// <returns>A Vector with a Record for every element</returns>
+        template<class Record>
+        Vector<Record> ToVector() const
         {
-            if( start + count > this->size() )
-                throw std::invalid_argument( "search range exceeds containers size" );
-            constexpr int result = -1;
-            for( unsigned int index = start; index < start + count; ++index )
-                if( this->operator[]( index ) == item )
-                    return index;
-            return result;
+            Vector<Record> records;
+            records.reserve( size() );
+            for( const auto& row : *this )
+                records.push_back( row.template As<Record>() );
+            return records;
         }
+#pragma endregion
 
+    private:
+        std::tuple<Vector<Fields>...> columns;
 
-        const int LastIndexOfGenericImplementation( T item, const unsigned int start, const unsigned int count ) const
+        template<std::size_t... Columns, class... Arguments>
+        void EmplaceBackGenericImplementation( std::index_sequence<Columns...>, Arguments&&... fields )
         {
-            if( start + count > this->size() )
-                throw std::invalid_argument( "search range exceeds containers size" );
-            int lastIndex = -1;
-            int index = 0;
-            for( auto it = this->cbegin() + start; it != this->cbegin() + (start + count); ++it, ++index )
-                if( *it == item )
-                    lastIndex = index;
-            return lastIndex;
+            std::size_t added = 0;
+            try
+            {
+                ((std::get<Columns>( columns ).emplace_back( std::forward<Arguments>( fields ) ), ++added), ...);
+            }
+            catch( ... )
+            {
+                ((Columns < added ? std::get<Columns>( columns ).pop_back() : void()), ...);
+                throw;
+            }
         }
 
+        template<std::size_t... Columns>
+        void GatherGenericImplementation( SoAVector& results, const std::vector<std::size_t>& indices, std::index_sequence<Columns...> ) const
+        {
+            auto gather = []( auto& target, const auto& source, const std::vector<std::size_t>& indices )
+            {
+                target.reserve( indices.size() );
+                for( const std::size_t index : indices )
+                    target.push_back( source[index] );
+            };
+            (gather( std::get<Columns>( results.columns ), std::get<Columns>( columns ), indices ), ...);
+        }
 
-        const int FindIndexGenericImplementation( std::function<bool( T )> predicate, const unsigned int start, const unsigned int count ) const
+        template<class Column, class Order>
+        static void PermuteGenericImplementation( Column& column, const Order& order )
         {
-            if( start + count > this->size() )
-                throw std::invalid_argument( "search range exceeds containers size" );
-            constexpr int result = -1;
-            for( unsigned int index = start; index < start + count; ++index )
-                if( predicate( this->operator[]( index ) ) )
-                    return index;
-            return result;
+            Column permuted;
+            permuted.reserve( order.size() );
+            for( const std::size_t index : order )
+                permuted.push_back( std::move( column[index] ) );
+            column.swap( permuted );
         }
     };
+
+    namespace pmr
+    {
+        /// <summary>
+        /// Vector whose memory comes from a std::pmr::memory_resource, such as a std::pmr::monotonic_buffer_resource arena
+        /// </summary>
+        template<class T>
+        using Vector = Cx::Vector<T, std::pmr::polymorphic_allocator<T>>;
+
+        /// <summary>
+        /// SortedVector whose memory comes from a std::pmr::memory_resource, such as a std::pmr::monotonic_buffer_resource arena
+        /// </summary>
+        template<class T>
+        using SortedVector = Cx::SortedVector<T, std::pmr::polymorphic_allocator<T>>;
+
+        /// <summary>
+        /// ChunkedVector whose chunks come from a std::pmr::memory_resource, such as a std::pmr::unsynchronized_pool_resource
+        /// </summary>
+        template<class T, std::size_t ChunkSize = DefaultChunkSize<T>()>
+        using ChunkedVector = Cx::ChunkedVector<T, ChunkSize, std::pmr::polymorphic_allocator<T>>;
+    }
 }
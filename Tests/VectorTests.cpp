@@ -4,6 +4,8 @@
 #include "CppUnitTest.h"
 #include "Vector.hpp"
 #include <array>
+#include <deque>
+#include <list>
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -35,6 +37,37 @@ namespace Cx
             float j;
         };
 
+        class CopyCounter
+        {
+        public:
+            CopyCounter() = default;
+            CopyCounter( int value ) : value{ value } {}
+            CopyCounter( const CopyCounter& other ) : value{ other.value } { ++copies; }
+            CopyCounter( CopyCounter&& other ) noexcept : value{ other.value } { ++moves; }
+            CopyCounter& operator=( const CopyCounter& other ) { value = other.value; ++copies; return *this; }
+            CopyCounter& operator=( CopyCounter&& other ) noexcept { value = other.value; ++moves; return *this; }
+
+            bool operator==( const CopyCounter& other ) const
+            {
+                return value == other.value;
+            }
+
+            bool operator<( const CopyCounter& other ) const
+            {
+                return value < other.value;
+            }
+
+            static void ResetCounters()
+            {
+                copies = 0;
+                moves = 0;
+            }
+
+            int value = 0;
+            static inline int copies = 0;
+            static inline int moves = 0;
+        };
+
     public:
 
         TEST_METHOD( ConstructVectorByCapacity )
@@ -115,6 +148,79 @@ namespace Cx
             Assert::IsTrue( vector[3] == 56 );
         }
 
+        TEST_METHOD( AddRangeByAnotherCxVectorGivenByRValueMovesElements )
+        {
+            Vector<CopyCounter> destination;
+            destination.AddRange( { CopyCounter( 1 ), CopyCounter( 2 ) } );
+            Vector<CopyCounter> source;
+            source.AddRange( { CopyCounter( 3 ), CopyCounter( 4 ), CopyCounter( 5 ) } );
+            destination.reserve( 8 );
+            CopyCounter::ResetCounters();
+
+            destination.AddRange( std::move( source ) );
+            Assert::IsTrue( destination.size() == 5 );
+            Assert::IsTrue( destination[2].value == 3 );
+            Assert::IsTrue( destination[4].value == 5 );
+            Assert::IsTrue( CopyCounter::copies == 0 );
+            Assert::IsTrue( CopyCounter::moves == 3 );
+        }
+
+        TEST_METHOD( AddRangeByRValueCxVectorAdoptsBufferWhenEmpty )
+        {
+            Vector<int> source;
+            source.AddRange( { 1,15,23,56 } );
+            const int* sourceData = source.data();
+            vector.AddRange( std::move( source ) );
+            Assert::IsTrue( vector.data() == sourceData );
+            Assert::IsTrue( vector.size() == 4 );
+            Assert::IsTrue( vector[3] == 56 );
+        }
+
+        TEST_METHOD( AddRangeByTheSameCxVectorDuplicatesElements )
+        {
+            vector.AddRange( { 1,2,3 } );
+            vector.AddRange( vector );
+            Assert::IsTrue( vector.size() == 6 );
+            Assert::IsTrue( vector[0] == 1 );
+            Assert::IsTrue( vector[3] == 1 );
+            Assert::IsTrue( vector[5] == 3 );
+        }
+
+        TEST_METHOD( AddRangeByIteratorPair )
+        {
+            std::deque<int> range = { 1, 15, 23, 56 };
+            vector.AddRange( range.begin() + 1, range.end() );
+            Assert::IsTrue( vector.size() == 3 );
+            Assert::IsTrue( vector[0] == 15 );
+            Assert::IsTrue( vector[1] == 23 );
+            Assert::IsTrue( vector[2] == 56 );
+        }
+
+        TEST_METHOD( AddRangeByGenericRangeGivenByReference )
+        {
+            std::deque<int> range = { 1, 15, 23, 56 };
+            vector.AddRange( range );
+            Assert::IsTrue( vector.size() == 4 );
+            Assert::IsTrue( vector[0] == 1 );
+            Assert::IsTrue( vector[3] == 56 );
+            Assert::IsTrue( range.size() == 4 );
+        }
+
+        TEST_METHOD( AddRangeByGenericRangeGivenByRValueMovesElements )
+        {
+            std::list<CopyCounter> range;
+            range.emplace_back( 1 );
+            range.emplace_back( 2 );
+            Vector<CopyCounter> counters;
+            counters.reserve( 2 );
+            CopyCounter::ResetCounters();
+
+            counters.AddRange( std::move( range ) );
+            Assert::IsTrue( counters.size() == 2 );
+            Assert::IsTrue( counters[1].value == 2 );
+            Assert::IsTrue( CopyCounter::copies == 0 );
+        }
+
         TEST_METHOD( ContainerWithBasicTypesContainsAnElement )
         {
             vector.AddRange( { 2,56,2,34,8,10 } );
@@ -198,6 +304,16 @@ namespace Cx
             Assert::IsTrue( newVector[4].i == 3 );
         }
 
+        TEST_METHOD( SortingThrowsForRangeExceedingContainerSize )
+        {
+            vector.AddRange( { 4,13,2,56,3 } );
+            Assert::ExpectException<std::out_of_range>( [&]()->void { vector.Sort( 2, 5 ); } );
+            Assert::ExpectException<std::out_of_range>( [&]()->void { vector.Sort( 3, 1 ); } );
+            Assert::ExpectException<std::out_of_range>( [&]()->void { vector.Sort( 2, 5, []( int a, int b )->bool { return a > b; } ); } );
+            Assert::IsTrue( vector[0] == 4 );
+            Assert::IsTrue( vector[4] == 3 );
+        }
+
 
         TEST_METHOD( SortingBasicTypesAtWholeScopeWithCustomComparer )
         {
@@ -229,6 +345,183 @@ namespace Cx
         }
 
 
+        TEST_METHOD( SortingLargeContainerOfSignedIntegersWithDefaultComparer )
+        {
+            for( int i = 0; i < 5000; ++i )
+                vector.push_back( ((i * 7919) % 10007) - 5000 );
+            vector.Sort();
+            Assert::IsTrue( vector.size() == 5000 );
+            Assert::IsTrue( vector[0] < 0 );
+            Assert::IsTrue( std::is_sorted( vector.begin(), vector.end() ) );
+        }
+
+        TEST_METHOD( SortingLargeContainerOfFloatingPointsWithDefaultComparer )
+        {
+            Vector<double> doubles;
+            for( int i = 0; i < 5000; ++i )
+                doubles.push_back( (((i * 7919) % 10007) - 5000) * 0.25 );
+            doubles.push_back( -1e300 );
+            doubles.push_back( 1e-300 );
+            doubles.Sort();
+            Assert::IsTrue( doubles[0] == -1e300 );
+            Assert::IsTrue( std::is_sorted( doubles.begin(), doubles.end() ) );
+        }
+
+        TEST_METHOD( SortByKeyKeepsOrderOfElementsWithEqualKeys )
+        {
+            Vector<Entity> entities;
+            entities.AddRange( { Entity( 3, 0 ), Entity( -1, 1 ), Entity( 3, 2 ), Entity( -5, 3 ), Entity( -1, 4 ) } );
+            entities.SortByKey( []( const Entity& e ) { return e.i; } );
+            Assert::IsTrue( entities[0] == Entity( -5, 3 ) );
+            Assert::IsTrue( entities[1] == Entity( -1, 1 ) );
+            Assert::IsTrue( entities[2] == Entity( -1, 4 ) );
+            Assert::IsTrue( entities[3] == Entity( 3, 0 ) );
+            Assert::IsTrue( entities[4] == Entity( 3, 2 ) );
+        }
+
+        TEST_METHOD( SortingBasicTypesInParallelWithDefaultComparer )
+        {
+            for( int i = 0; i < 20000; ++i )
+                vector.push_back( (i * 7919) % 10007 );
+            ExecutionContext context( 4, 64 );
+            vector.Sort( context );
+            Assert::IsTrue( vector.size() == 20000 );
+            Assert::IsTrue( std::is_sorted( vector.begin(), vector.end() ) );
+        }
+
+        TEST_METHOD( SortingBasicTypesInParallelWithCustomComparer )
+        {
+            for( int i = 0; i < 20000; ++i )
+                vector.push_back( i % 100 );
+            vector.Sort( Cx::par, []( int a, int b )->bool
+                {
+                    return a > b;
+                } );
+            Assert::IsTrue( vector[0] == 99 );
+            Assert::IsTrue( vector[19999] == 0 );
+            Assert::IsTrue( std::is_sorted( vector.begin(), vector.end(), []( int a, int b ) { return a > b; } ) );
+        }
+
+        TEST_METHOD( SortingInParallelKeepsEveryElement )
+        {
+            Vector<std::string> words;
+            for( int i = 0; i < 20000; ++i )
+                words.push_back( std::to_string( (i * 7919) % 313 ) );
+            std::vector<std::string> expected( words.begin(), words.end() );
+            std::sort( expected.begin(), expected.end() );
+            ExecutionContext context( 4, 64 );
+            words.Sort( context );
+            Assert::IsTrue( std::equal( words.begin(), words.end(), expected.begin(), expected.end() ) );
+        }
+
+        TEST_METHOD( SortingWithSequencedPolicyOrSingleThreadedContext )
+        {
+            vector.AddRange( { 4,13,2,56,3 } );
+            vector.Sort( Cx::seq );
+            Assert::IsTrue( vector[0] == 2 );
+            Assert::IsTrue( vector[4] == 56 );
+
+            ExecutionContext context( 1 );
+            vector.Sort( context, []( int a, int b )->bool { return a > b; } );
+            Assert::IsTrue( vector[0] == 56 );
+            Assert::IsTrue( vector[4] == 2 );
+        }
+
+        TEST_METHOD( SortingInParallelRethrowsComparerException )
+        {
+            for( int i = 0; i < 20000; ++i )
+                vector.push_back( (i * 7919) % 10007 );
+            ExecutionContext context( 4, 64 );
+            Assert::ExpectException<std::runtime_error>( [&]()->void
+                {
+                    vector.Sort( context, []( int a, int b )->bool
+                        {
+                            if( a == 5000 )
+                                throw std::runtime_error( "comparer failed" );
+                            return a < b;
+                        } );
+                } );
+        }
+
+        TEST_METHOD( ParallelQueriesMatchSequentialResults )
+        {
+            for( int i = 0; i < 20000; ++i )
+                vector.push_back( (i * 7919) % 10007 );
+            ExecutionContext context( 4, 64 );
+            auto isSmall = []( const int& element )->bool { return element < 100; };
+
+            auto found = vector.FindAll( context, isSmall );
+            Assert::IsTrue( found == vector.FindAll( isSmall ) );
+            Assert::IsTrue( vector.Exists( context, isSmall ) );
+            Assert::IsFalse( vector.Exists( context, []( const int& element )->bool { return element > 10007; } ) );
+            Assert::IsTrue( vector.TrueForAll( context, []( const int& element )->bool { return element >= 0; } ) );
+            Assert::IsFalse( vector.TrueForAll( context, isSmall ) );
+            Assert::IsTrue( vector.FindIndex( context, isSmall ) == vector.FindIndex( isSmall ) );
+            Assert::IsTrue( vector.FindIndex( context, []( const int& element )->bool { return element == -1; } ) == -1 );
+
+            auto texts = vector.ConvertAll<std::string>( context, []( const int& element ) { return std::to_string( element ); } );
+            Assert::IsTrue( texts.size() == vector.size() );
+            Assert::IsTrue( texts[19999] == std::to_string( vector[19999] ) );
+
+            vector.ForEach( context, []( int& element ) { element += 1; } );
+            Assert::IsTrue( vector.FindIndex( context, []( const int& element )->bool { return element == 0; } ) == -1 );
+            Assert::IsTrue( vector.Exists( Cx::seq, []( const int& element )->bool { return element == 10007; } ) );
+        }
+
+        TEST_METHOD( ParallelRemoveAllKeepsOrderOfRemainingElements )
+        {
+            for( int i = 0; i < 20000; ++i )
+                vector.push_back( (i * 7919) % 10007 );
+            auto expected = vector;
+            auto isOdd = []( const int& element )->bool { return element % 2 == 1; };
+            expected.RemoveAll( isOdd );
+            ExecutionContext context( 4, 64 );
+            vector.RemoveAll( context, isOdd );
+            Assert::IsTrue( vector == expected );
+
+            Vector<std::string> words;
+            for( int i = 0; i < 5000; ++i )
+                words.push_back( std::to_string( i ) );
+            words.RemoveAll( context, []( const std::string& word )->bool { return word.back() != '7'; } );
+            Assert::IsTrue( words.size() == 500 );
+            Assert::IsTrue( words[0] == "7" );
+            Assert::IsTrue( words[499] == "4997" );
+            words.RemoveAll( context, []( const std::string& )->bool { return true; } );
+            Assert::IsTrue( words.empty() );
+        }
+
+        TEST_METHOD( ParallelQueriesRethrowPredicateException )
+        {
+            for( int i = 0; i < 20000; ++i )
+                vector.push_back( i );
+            ExecutionContext context( 4, 64 );
+            Assert::ExpectException<std::runtime_error>( [&]()->void
+                {
+                    vector.FindAll( context, []( const int& element )->bool
+                        {
+                            if( element == 15000 )
+                                throw std::runtime_error( "predicate failed" );
+                            return false;
+                        } );
+                } );
+        }
+
+        TEST_METHOD( TaskGroupRunThrowingBeforeQueueingLeavesNothingToWaitFor )
+        {
+            struct UncopyableTask
+            {
+                UncopyableTask() = default;
+                UncopyableTask( const UncopyableTask& ) { throw std::runtime_error( "copy failed" ); }
+                void operator()() const {}
+            };
+            ExecutionContext context( 2 );
+            TaskGroup group( context );
+            UncopyableTask task;
+            Assert::ExpectException<std::runtime_error>( [&]()->void { group.Run( task ); } );
+            group.Wait();
+        }
+
+
         TEST_METHOD( BasicTypeElementExistsInTheContainer )
         {
             vector.AddRange( { 3,4,12,5,98,11 } );
@@ -400,6 +693,27 @@ namespace Cx
             Assert::IsTrue( destinationArray[8] == 4 );
         }
 
+        TEST_METHOD( CopyToTheSameVectorAllElementsWithCustomStartingIndex )
+        {
+            vector.AddRange( { 1, 2, 3 } );
+            vector.CopyTo( vector, 1 );
+            Assert::IsTrue( vector.size() == 6 );
+            Assert::IsTrue( vector[0] == 1 );
+            Assert::IsTrue( vector[1] == 1 );
+            Assert::IsTrue( vector[2] == 2 );
+            Assert::IsTrue( vector[3] == 3 );
+            Assert::IsTrue( vector[4] == 2 );
+            Assert::IsTrue( vector[5] == 3 );
+        }
+
+        TEST_METHOD( CopyToVectorThrowsWhenCountExceedsSourceSize )
+        {
+            vector.AddRange( { 0, 1, 2, 3, 4, 5 } );
+            std::vector<int> destinationArray = { 0, 1, 2 };
+            Assert::ExpectException<std::out_of_range>( [&]()->void { vector.CopyTo( 4, destinationArray, 1, 3 ); } );
+            Assert::IsTrue( destinationArray.size() == 3 );
+        }
+
 
         TEST_METHOD( FindBasicTypeElement )
         {
@@ -479,8 +793,164 @@ namespace Cx
         TEST_METHOD( BinarySearchFailureForBasicType )
         {
             vector.AddRange( { 1,2,4,5,6,7,8,9 } );
-            Assert::IsTrue( vector.BinarySearch( 11 ) == -1 );
-            Assert::IsTrue( vector.BinarySearch( 3 ) == -1 );
+            Assert::IsTrue( vector.BinarySearch( 11 ) == ~8 );
+            Assert::IsTrue( vector.BinarySearch( 3 ) == ~2 );
+            Assert::IsTrue( vector.BinarySearch( 0 ) == ~0 );
+        }
+
+        TEST_METHOD( BinarySearchInEmptyContainer )
+        {
+            Assert::IsTrue( vector.BinarySearch( 5 ) == ~0 );
+        }
+
+        TEST_METHOD( BinarySearchReturnsFirstOfEqualElements )
+        {
+            vector.AddRange( { 1,3,3,3,3,3,3,8,9 } );
+            Assert::IsTrue( vector.BinarySearch( 3 ) == 1 );
+        }
+
+        TEST_METHOD( BinarySearchWithCustomComparer )
+        {
+            vector.AddRange( { 9,8,7,5,4,3,1 } );
+            auto descending = []( const int& a, const int& b )->bool { return a > b; };
+            Assert::IsTrue( vector.BinarySearch( 7, descending ) == 2 );
+            Assert::IsTrue( vector.BinarySearch( 6, descending ) == ~3 );
+            Assert::IsTrue( vector.BinarySearch( 2, 3, 4, descending ) == 4 );
+            Assert::IsTrue( vector.BinarySearch( 2, 3, 1, descending ) == ~5 );
+            Assert::ExpectException<std::invalid_argument>( [&]()->void { vector.BinarySearch( 5, 3, 1, descending ); } );
+        }
+
+        TEST_METHOD( BinarySearchByKeyForCustomType )
+        {
+            Vector<Entity> entities;
+            entities.AddRange( { Entity( 1, 5 ), Entity( 4, 2 ), Entity( 7, 9 ), Entity( 12, 1 ) } );
+            auto byKey = []( const Entity& e ) { return e.i; };
+            Assert::IsTrue( entities.BinarySearchByKey( 7, byKey ) == 2 );
+            Assert::IsTrue( entities.BinarySearchByKey( 5, byKey ) == ~2 );
+            Assert::IsTrue( entities.BinarySearchByKey( 20, byKey ) == ~4 );
+        }
+
+        TEST_METHOD( SearchIndexLookupsMatchBinarySearch )
+        {
+            for( int size = 0; size < 40; ++size )
+            {
+                Vector<int> sorted;
+                for( int i = 0; i < size; ++i )
+                    sorted.push_back( 2 * (i / 2) );
+                const SearchIndex<int> index( sorted );
+                Assert::IsTrue( index.size() == sorted.size() );
+                for( int item = -1; item <= size + 1; ++item )
+                {
+                    const int result = sorted.BinarySearch( item );
+                    Assert::IsTrue( index.BinarySearch( item ) == result );
+                    Assert::IsTrue( index.Contains( item ) == (result >= 0) );
+                    Assert::IsTrue( index.IndexOf( item ) == sorted.IndexOf( item ) );
+                }
+            }
+        }
+
+        TEST_METHOD( SearchIndexIsSnapshotOfVector )
+        {
+            vector.AddRange( { 1,3,5,7,9 } );
+            const SearchIndex<int> index( vector );
+            vector.RemoveAt( 0 );
+            vector[0] = 42;
+            Assert::IsTrue( index.size() == 5 );
+            Assert::IsTrue( index.IndexOf( 3 ) == 1 );
+            Assert::IsTrue( index.BinarySearch( 42 ) == ~5 );
+            Assert::IsTrue( vector.IndexOf( 42 ) == 0 );
+        }
+
+        TEST_METHOD( SearchIndexThrowsForUnsortedVector )
+        {
+            vector.AddRange( { 3,1,2 } );
+            Assert::ExpectException<std::logic_error>( [&]()->void { SearchIndex<int> index( vector ); } );
+        }
+
+        TEST_METHOD( SearchIndexIndexOfComparesEquivalentElements )
+        {
+            struct Tagged
+            {
+                int key;
+                char tag;
+                bool operator<( const Tagged& other ) const { return key < other.key; }
+                bool operator==( const Tagged& other ) const { return key == other.key && tag == other.tag; }
+            };
+            Vector<Tagged> sorted;
+            sorted.AddRange( { { 1, 'a' }, { 2, 'a' }, { 2, 'b' }, { 2, 'c' }, { 3, 'a' }, { 4, 'a' }, { 4, 'b' } } );
+            const SearchIndex<Tagged> index( sorted );
+            Assert::IsTrue( index.IndexOf( { 2, 'a' } ) == 1 );
+            Assert::IsTrue( index.IndexOf( { 2, 'c' } ) == 3 );
+            Assert::IsTrue( index.IndexOf( { 4, 'b' } ) == 6 );
+            Assert::IsTrue( index.IndexOf( { 2, 'd' } ) == -1 );
+            Assert::IsFalse( index.Contains( { 3, 'b' } ) );
+            Assert::IsTrue( index.BinarySearch( { 2, 'c' } ) == 1 );
+        }
+
+        TEST_METHOD( SortedVectorLookupsAfterSort )
+        {
+            SortedVector<int> sorted{ 5,1,4,1,3 };
+            Assert::IsFalse( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.IndexOf( 4 ) == 2 );
+            sorted.Sort();
+            Assert::IsTrue( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.Contains( 4 ) );
+            Assert::IsFalse( sorted.Contains( 2 ) );
+            Assert::IsTrue( sorted.IndexOf( 1 ) == 0 );
+            Assert::IsTrue( sorted.LastIndexOf( 1 ) == 1 );
+            Assert::IsTrue( sorted.IndexOf( 6 ) == -1 );
+            sorted.Remove( 4 );
+            Assert::IsTrue( sorted.IsKnownSorted() );
+            Assert::IsFalse( sorted.Contains( 4 ) );
+            Assert::IsTrue( sorted.IndexOf( 5 ) == 3 );
+        }
+
+        TEST_METHOD( SortedVectorKeepsStateForOrderedInsertions )
+        {
+            SortedVector<int> sorted;
+            Assert::IsTrue( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.InsertSorted( 3 ) == 0 );
+            Assert::IsTrue( sorted.InsertSorted( 1 ) == 0 );
+            Assert::IsTrue( sorted.InsertSorted( 3 ) == 2 );
+            sorted.AddRange( { 4,6 } );
+            sorted.push_back( 7 );
+            sorted.InsertRange( 4, { 5 } );
+            Assert::IsTrue( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.IndexOf( 5 ) == 4 );
+            sorted.push_back( 2 );
+            Assert::IsFalse( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.Contains( 2 ) );
+            Assert::ExpectException<std::logic_error>( [&]()->void { sorted.InsertSorted( 8 ); } );
+        }
+
+        TEST_METHOD( SortedVectorStateClearedByReordering )
+        {
+            SortedVector<int> sorted{ 1,2,3 };
+            sorted.Sort();
+            sorted.Reverse();
+            Assert::IsFalse( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.IndexOf( 3 ) == 0 );
+            sorted.Sort();
+            sorted.Sort( []( const int& left, const int& right ) { return left > right; } );
+            Assert::IsFalse( sorted.IsKnownSorted() );
+            sorted.Sort();
+            for( const auto& element : std::as_const( sorted ) )
+                Assert::IsTrue( element > 0 );
+            Assert::IsTrue( sorted.IsKnownSorted() );
+            sorted[0] = 10;
+            Assert::IsFalse( sorted.IsKnownSorted() );
+            Assert::IsTrue( sorted.Contains( 10 ) );
+        }
+
+        TEST_METHOD( SortedVectorRemoveAllOfMergesSortedValues )
+        {
+            SortedVector<int> sorted{ 1,2,2,3,5,8,8,9 };
+            sorted.Sort();
+            sorted.RemoveAllOf( std::vector<int>{ 2,4,8 } );
+            Assert::IsTrue( sorted == Vector<int>( { 1,3,5,9 } ) );
+            sorted.RetainAllOf( { 9,1,5 } );
+            Assert::IsTrue( sorted == Vector<int>( { 1,5,9 } ) );
+            Assert::IsTrue( sorted.IsKnownSorted() );
         }
 
 
@@ -846,6 +1316,17 @@ namespace Cx
             Assert::IsTrue( result == -1 );
         }
 
+        TEST_METHOD( FindLastIndexReturnsIndexCountedFromContainerBeginning )
+        {
+            vector.AddRange( { 1,3,2,3,5,67,3,2,54,3,12 } );
+            auto isThree = []( const int& element )->bool { return element == 3; };
+            Assert::IsTrue( vector.FindLastIndex( isThree ) == 9 );
+            Assert::IsTrue( vector.FindLastIndex( 8, isThree ) == 6 );
+            Assert::IsTrue( vector.FindLastIndex( 2, 6, isThree ) == 3 );
+            Assert::IsTrue( vector.FindLastIndex( 4, 6, isThree ) == -1 );
+            Assert::IsTrue( vector.FindLast( []( const int& element )->bool { return element < 3; } ) == 2 );
+        }
+
         TEST_METHOD( FindLastIndexFailsForContainerRangeLimitedByStartEndIndex )
         {
             vector.AddRange( { 1,3,2,3,5,67,3,2,54,3,12 } );
@@ -998,6 +1479,69 @@ namespace Cx
         }
 
 
+        TEST_METHOD( InsertRangeForRValueCxVectorMovesElements )
+        {
+            Vector<CopyCounter> counters;
+            counters.AddRange( { CopyCounter( 1 ), CopyCounter( 2 ), CopyCounter( 3 ) } );
+            Vector<CopyCounter> range;
+            range.AddRange( { CopyCounter( 10 ), CopyCounter( 20 ) } );
+            counters.reserve( 5 );
+            CopyCounter::ResetCounters();
+
+            counters.InsertRange( 1, std::move( range ) );
+            Assert::IsTrue( counters.size() == 5 );
+            Assert::IsTrue( counters[0].value == 1 );
+            Assert::IsTrue( counters[1].value == 10 );
+            Assert::IsTrue( counters[2].value == 20 );
+            Assert::IsTrue( counters[3].value == 2 );
+            Assert::IsTrue( counters[4].value == 3 );
+            Assert::IsTrue( CopyCounter::copies == 0 );
+        }
+
+        TEST_METHOD( InsertRangeSuccessForDataFromTheSameVector )
+        {
+            vector.AddRange( { 1,2,3 } );
+            vector.InsertRange( 1, vector );
+            Assert::IsTrue( vector.size() == 6 );
+            Assert::IsTrue( vector[0] == 1 );
+            Assert::IsTrue( vector[1] == 1 );
+            Assert::IsTrue( vector[2] == 2 );
+            Assert::IsTrue( vector[3] == 3 );
+            Assert::IsTrue( vector[4] == 2 );
+            Assert::IsTrue( vector[5] == 3 );
+        }
+
+        TEST_METHOD( InsertRangeSuccessForDataAsIteratorPair )
+        {
+            vector.AddRange( { 1,2,3,4 } );
+            std::list<int> range = { 10,20,30 };
+            vector.InsertRange( 1, range.begin(), range.end() );
+            Assert::IsTrue( vector.size() == 7 );
+            Assert::IsTrue( vector[0] == 1 );
+            Assert::IsTrue( vector[1] == 10 );
+            Assert::IsTrue( vector[3] == 30 );
+            Assert::IsTrue( vector[4] == 2 );
+            Assert::IsTrue( vector[6] == 4 );
+        }
+
+        TEST_METHOD( InsertRangeSuccessForDataAsGenericRange )
+        {
+            vector.AddRange( { 1,2,3,4 } );
+            vector.InsertRange( 4, std::deque<int>{ 10,20 } );
+            Assert::IsTrue( vector.size() == 6 );
+            Assert::IsTrue( vector[3] == 4 );
+            Assert::IsTrue( vector[4] == 10 );
+            Assert::IsTrue( vector[5] == 20 );
+        }
+
+        TEST_METHOD( InsertRangeThrowsForGenericRangeBeyondContainerSize )
+        {
+            vector.AddRange( { 1,2,3,4 } );
+            std::deque<int> range = { 10,20 };
+            Assert::ExpectException<std::invalid_argument>( [&]()->void { vector.InsertRange( 5, range ); } );
+            Assert::ExpectException<std::invalid_argument>( [&]()->void { vector.InsertRange( 5, range.begin(), range.end() ); } );
+        }
+
         TEST_METHOD( GetRangeSuccessForCorrectRange )
         {
             vector.AddRange( { 1,2,3,4,5,6,7,8,9 } );
@@ -1075,6 +1619,17 @@ namespace Cx
             Assert::IsTrue( result == -1 );
         }
 
+        TEST_METHOD( LastIndexOfReturnsIndexCountedFromContainerBeginning )
+        {
+            vector.AddRange( { 1,3,2,3,5,67,3,2,54,3,12 } );
+            Assert::IsTrue( vector.LastIndexOf( 3, 2, 5 ) == 6 );
+            Assert::IsTrue( vector.LastIndexOf( 2, 1, 5 ) == 2 );
+
+            Vector<std::string> words{ "a", "b", "a", "c" };
+            Assert::IsTrue( words.LastIndexOf( "a", 1, 3 ) == 2 );
+            Assert::IsTrue( words.LastIndexOf( "b", 2, 2 ) == -1 );
+        }
+
         TEST_METHOD( LastIndexOfThrowsForContainerRangeLimitedByEndIndex )
         {
             vector.AddRange( { 1,3,2,3,5,67,3,2,54,3,12 } );
@@ -1092,6 +1647,48 @@ namespace Cx
             Assert::IsTrue( result == 0 );
         }
 
+        TEST_METHOD( SearchingLongVectorsOfArithmeticTypes )
+        {
+            for( int i = 0; i < 200; ++i )
+                vector.push_back( i % 50 );
+            Assert::IsTrue( vector.IndexOf( 49 ) == 49 );
+            Assert::IsTrue( vector.IndexOf( 7, 60 ) == 107 );
+            Assert::IsTrue( vector.IndexOf( 7, 60, 40 ) == -1 );
+            Assert::IsTrue( vector.LastIndexOf( 0 ) == 150 );
+            Assert::IsTrue( vector.Contains( 33 ) );
+            Assert::IsFalse( vector.Contains( 50 ) );
+
+            Vector<char> text;
+            for( int i = 0; i < 100; ++i )
+                text.push_back( static_cast<char>('a' + i % 26) );
+            Assert::IsTrue( text.IndexOf( 'z' ) == 25 );
+            Assert::IsTrue( text.LastIndexOf( 'a' ) == 78 );
+            Assert::IsFalse( text.Contains( '!' ) );
+
+            Vector<long long> large{ 1LL << 40, 1, (1LL << 40) + 1, 1 };
+            Assert::IsTrue( large.IndexOf( 1 ) == 1 );
+            Assert::IsTrue( large.IndexOf( (1LL << 40) + 1 ) == 2 );
+        }
+
+        TEST_METHOD( SearchingFloatingPointComparesByValue )
+        {
+            Vector<float> values{ 1.0f, std::numeric_limits<float>::quiet_NaN(), -0.0f };
+            for( int i = 0; i < 30; ++i )
+                values.push_back( 2.0f );
+            Assert::IsTrue( values.IndexOf( 0.0f ) == 2 );
+            Assert::IsTrue( values.IndexOf( std::numeric_limits<float>::quiet_NaN() ) == -1 );
+            Assert::IsTrue( values.LastIndexOf( 2.0f ) == 32 );
+            Assert::IsFalse( values.Contains( 3.0f ) );
+        }
+
+        TEST_METHOD( SearchingVectorOfBool )
+        {
+            Vector<bool> flags{ true,false };
+            Assert::IsTrue( flags.IndexOf( false ) == 1 );
+            Assert::IsTrue( flags.LastIndexOf( true ) == 0 );
+            Assert::IsTrue( flags.Contains( false ) );
+        }
+
 
         TEST_METHOD( ConvertAllSuccessForBasicType )
         {
@@ -1124,6 +1721,80 @@ namespace Cx
             Assert::IsTrue( vector.size() == 10 );
         }
 
+        TEST_METHOD( RemoveAtManyIndicesInAnyOrder )
+        {
+            vector.AddRange( { 0,1,2,3,4,5,6,7,8,9 } );
+            vector.RemoveAt( std::vector<std::size_t>{ 7, 0, 3, 4, 7, 9 } );
+            Assert::IsTrue( vector == Vector<int>( { 1,2,5,6,8 } ) );
+            vector.RemoveAt( std::vector<std::size_t>{} );
+            Assert::IsTrue( vector.size() == 5 );
+            Assert::ExpectException<std::invalid_argument>( [&]()->void{ vector.RemoveAt( std::vector<std::size_t>{ 1, 5 } ); } );
+            Assert::IsTrue( vector.size() == 5 );
+        }
+
+        TEST_METHOD( RemoveAllOfAndRetainAllOfKeepOrder )
+        {
+            vector.AddRange( { 5,1,4,1,3,9,2,6,5,3 } );
+            vector.RemoveAllOf( std::list<int>{ 3,1,7 } );
+            Assert::IsTrue( vector == Vector<int>( { 5,4,9,2,6,5 } ) );
+            vector.RetainAllOf( { 5,6,2 } );
+            Assert::IsTrue( vector == Vector<int>( { 5,2,6,5 } ) );
+            vector.RemoveAllOf( vector );
+            Assert::IsTrue( vector.empty() );
+        }
+
+        TEST_METHOD( RemoveAllOfWithCustomHashAndEquality )
+        {
+            Vector<std::string> words{ "Cat", "dog", "EAGLE", "cow", "Dog" };
+            auto lower = []( std::string text ) { for( auto& c : text ) c = static_cast<char>(std::tolower( c )); return text; };
+            auto hash = [&]( const std::string& text ) { return std::hash<std::string>()(lower( text )); };
+            auto equal = [&]( const std::string& left, const std::string& right ) { return lower( left ) == lower( right ); };
+            words.RemoveAllOf( std::array<std::string, 2>{ "DOG", "eagle" }, hash, equal );
+            Assert::IsTrue( words == Vector<std::string>( { "Cat", "cow" } ) );
+        }
+
+        TEST_METHOD( RemoveRangesMergesOverlappingRanges )
+        {
+            vector.AddRange( { 0,1,2,3,4,5,6,7,8,9 } );
+            vector.RemoveRanges( { { 6, 2 }, { 1, 2 }, { 2, 2 }, { 9, 0 }, { 8, 1 } } );
+            Assert::IsTrue( vector == Vector<int>( { 0,4,5,9 } ) );
+            Assert::ExpectException<std::invalid_argument>( [&]()->void{ vector.RemoveRanges( { { 0, 1 }, { 3, 2 } } ); } );
+            Assert::IsTrue( vector.size() == 4 );
+            vector.RemoveRanges( { { 0, 4 } } );
+            Assert::IsTrue( vector.empty() );
+        }
+
+        TEST_METHOD( RemoveAtSwapBackMovesLastElementIntoPlace )
+        {
+            vector.AddRange( { 0,1,2,3,4 } );
+            vector.RemoveAtSwapBack( 1 );
+            Assert::IsTrue( vector == Vector<int>( { 0,4,2,3 } ) );
+            vector.RemoveAtSwapBack( 3 );
+            Assert::IsTrue( vector == Vector<int>( { 0,4,2 } ) );
+            vector.RemoveUnordered( 0 );
+            Assert::IsTrue( vector == Vector<int>( { 2,4 } ) );
+            vector.RemoveUnordered( 7 );
+            Assert::IsTrue( vector.size() == 2 );
+            Assert::ExpectException<std::invalid_argument>( [&]()->void{ vector.RemoveAtSwapBack( 2 ); } );
+        }
+
+        TEST_METHOD( RemoveAllUnorderedKeepsAllRemainingElements )
+        {
+            vector.AddRange( { 1,2,3,4,5,6,7,8,9,10 } );
+            int calls = 0;
+            vector.RemoveAllUnordered( [&calls]( const int& element )->bool
+                {
+                    ++calls;
+                    return element % 3 != 0 && element < 9;
+                } );
+            Assert::IsTrue( calls == 10 );
+            Assert::IsTrue( vector.size() == 4 );
+            std::sort( vector.begin(), vector.end() );
+            Assert::IsTrue( vector == Vector<int>( { 3,6,9,10 } ) );
+            vector.RemoveAllUnordered( []( const int& )->bool { return true; } );
+            Assert::IsTrue( vector.empty() );
+        }
+
 
         TEST_METHOD( ForEachElementActionIsPerformed )
         {
@@ -1157,5 +1828,277 @@ namespace Cx
             Assert::IsTrue( results.size() == 0 );
         }
 
+        TEST_METHOD( ScanningMethodsPerformNoElementCopies )
+        {
+            Vector<CopyCounter> counters;
+            counters.AddRange( { CopyCounter( 1 ), CopyCounter( 2 ), CopyCounter( 3 ), CopyCounter( 2 ) } );
+            const CopyCounter missing( 7 );
+            const CopyCounter present( 2 );
+            CopyCounter::ResetCounters();
+
+            Assert::IsFalse( counters.Contains( missing ) );
+            Assert::IsTrue( counters.IndexOf( present ) == 1 );
+            Assert::IsTrue( counters.LastIndexOf( present ) == 3 );
+            Assert::IsTrue( counters.Exists( []( const CopyCounter& c )->bool { return c.value == 3; } ) );
+            Assert::IsTrue( counters.FindIndex( []( const CopyCounter& c )->bool { return c.value == 3; } ) == 2 );
+            Assert::IsTrue( counters.FindLastIndex( []( const CopyCounter& c )->bool { return c.value == 1; } ) == 0 );
+            Assert::IsTrue( counters.TrueForAll( []( const CopyCounter& c )->bool { return c.value > 0; } ) );
+            Assert::IsTrue( counters.FindAll( []( const CopyCounter& c )->bool { return c.value > 5; } ).size() == 0 );
+            counters.Remove( missing );
+
+            Assert::IsTrue( CopyCounter::copies == 0 );
+            Assert::IsTrue( CopyCounter::moves == 0 );
+        }
+
+        TEST_METHOD( FindAllCopiesOnlyMatchingElements )
+        {
+            Vector<CopyCounter> counters;
+            counters.AddRange( { CopyCounter( 1 ), CopyCounter( 2 ), CopyCounter( 3 ), CopyCounter( 4 ) } );
+            CopyCounter::ResetCounters();
+
+            auto results = counters.FindAll( []( const CopyCounter& c )->bool { return c.value % 2 == 0; } );
+            Assert::IsTrue( results.size() == 2 );
+            Assert::IsTrue( CopyCounter::copies == 2 );
+        }
+
+        TEST_METHOD( FindAllSuccessForStdFunctionPredicate )
+        {
+            vector.AddRange( { 13,2,14,3,1,15,16,23,24 } );
+            std::function<bool( int )> predicate = []( int element )->bool {return element % 2 == 0; };
+            Vector<int> results;
+            results = vector.FindAll( predicate );
+            Assert::IsTrue( results.size() == 4 );
+            Assert::IsTrue( results[0] == 2 );
+            Assert::IsTrue( results[3] == 24 );
+        }
+
+        TEST_METHOD( FindAllSuccessForCapturingLambdaPredicate )
+        {
+            vector.AddRange( { 13,2,14,3,1,15,16,23,24 } );
+            const int threshold = 15;
+            Vector<int> results;
+            results = vector.FindAll( [threshold]( const int& element )->bool {return element > threshold; } );
+            Assert::IsTrue( results.size() == 3 );
+            Assert::IsTrue( results[0] == 16 );
+            Assert::IsTrue( results[1] == 23 );
+            Assert::IsTrue( results[2] == 24 );
+        }
+
+        TEST_METHOD( QueryFusesStagesIntoOneLazyPass )
+        {
+            vector.AddRange( { 13,2,14,3,1,15,16,23,24 } );
+            int selected = 0;
+            auto query = vector.Query()
+                .Where( []( const int& element ) { return element > 2; } )
+                .Select( [&selected]( const int& element ) { ++selected; return std::to_string( element ); } )
+                .Skip( 1 )
+                .Take( 3 );
+            Assert::IsTrue( selected == 0 );
+            Assert::IsTrue( query.ToVector() == Vector<std::string>( { "14", "3", "15" } ) );
+            Assert::IsTrue( selected == 4 );
+            Assert::IsTrue( query.First() == "14" );
+            Assert::IsTrue( selected == 6 );
+        }
+
+        TEST_METHOD( QueryTerminalOperations )
+        {
+            vector.AddRange( { 5,8,1,9,4 } );
+            Assert::IsTrue( vector.Query().Count() == 5 );
+            Assert::IsTrue( vector.Query().Skip( 2 ).Count() == 3 );
+            Assert::IsTrue( vector.Query().Count( []( const int& element ) { return element > 4; } ) == 3 );
+            Assert::IsTrue( vector.Query().Any( []( const int& element ) { return element == 9; } ) );
+            Assert::IsFalse( vector.Query().Skip( 5 ).Any() );
+            Assert::IsTrue( vector.Query().First( []( const int& element ) { return element > 8; } ) == 9 );
+            Assert::IsTrue( vector.Query().Select( []( const int& element ) { return element * 2; } ).Take( 3 ).Sum() == 28 );
+            Assert::ExpectException<std::logic_error>( [&]()->void { vector.Query().Where( []( const int& element ) { return element > 9; } ).First(); } );
+        }
+
+        TEST_METHOD( PmrVectorPropagatesMemoryResourceToResults )
+        {
+            std::array<std::byte, 4096> buffer;
+            std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size(), std::pmr::null_memory_resource() );
+            pmr::Vector<int> numbers( &arena );
+            numbers.AddRange( { 13,2,14,3,1,15,16,23,24 } );
+            auto found = numbers.FindAll( []( const int& element ) { return element > 14; } );
+            auto converted = numbers.ConvertAll<double>( []( const int& element ) { return element / 2.0; } );
+            auto range = numbers.GetRange( 1, 4 );
+            auto queried = numbers.Query().Skip( 6 ).ToVector( numbers.get_allocator() );
+            Assert::IsTrue( found.get_allocator().resource() == &arena );
+            Assert::IsTrue( converted.get_allocator().resource() == &arena );
+            Assert::IsTrue( range.get_allocator().resource() == &arena );
+            Assert::IsTrue( found == pmr::Vector<int>( { 15,16,23,24 } ) );
+            Assert::IsTrue( converted[0] == 6.5 );
+            Assert::IsTrue( range == pmr::Vector<int>( { 2,14,3 } ) );
+            Assert::IsTrue( queried == pmr::Vector<int>( { 16,23,24 } ) );
+        }
+
+        TEST_METHOD( PmrSortedVectorUsesMemoryResource )
+        {
+            std::array<std::byte, 1024> buffer;
+            std::pmr::monotonic_buffer_resource arena( buffer.data(), buffer.size(), std::pmr::null_memory_resource() );
+            pmr::SortedVector<int> sorted( &arena );
+            Assert::IsTrue( sorted.IsKnownSorted() );
+            sorted.InsertSorted( 5 );
+            sorted.InsertSorted( 1 );
+            sorted.InsertSorted( 3 );
+            Assert::IsTrue( sorted.IndexOf( 5 ) == 2 );
+            Assert::IsTrue( sorted.get_allocator().resource() == &arena );
+        }
+
+        TEST_METHOD( PmrVectorAddRangeKeepsItsOwnMemoryResource )
+        {
+            std::array<std::byte, 1024> targetBuffer;
+            std::pmr::monotonic_buffer_resource targetArena( targetBuffer.data(), targetBuffer.size(), std::pmr::null_memory_resource() );
+            pmr::Vector<int> target( &targetArena );
+            {
+                std::pmr::monotonic_buffer_resource sourceArena;
+                pmr::Vector<int> source( { 13,2,14 }, &sourceArena );
+                target.AddRange( std::move( source ) );
+            }
+            const auto* first = reinterpret_cast<const std::byte*>(target.data());
+            Assert::IsTrue( target.get_allocator().resource() == &targetArena );
+            Assert::IsTrue( first >= targetBuffer.data() && first < targetBuffer.data() + targetBuffer.size() );
+            Assert::IsTrue( target == pmr::Vector<int>( { 13,2,14 } ) );
+        }
+
+        TEST_METHOD( SmallVectorKeepsElementsInlineUntilItGrowsBeyondN )
+        {
+            SmallVector<int, 4> small{ 13,2,14 };
+            Assert::IsTrue( small.IsInline() );
+            small.push_back( 3 );
+            small.Sort();
+            Assert::IsTrue( small.IsInline() );
+            Assert::IsTrue( small.IndexOf( 13 ) == 2 );
+            small.AddRange( { 1,15 } );
+            Assert::IsFalse( small.IsInline() );
+            small.RemoveAll( []( const int& element ) { return element > 10; } );
+            small.shrink_to_fit();
+            Assert::IsTrue( small.IsInline() );
+            Assert::IsTrue( small == SmallVector<int, 4>( { 2,3,1 } ) );
+            auto found = small.FindAll( []( const int& element ) { return element < 3; } );
+            Assert::IsTrue( found.size() == 2 && found[0] == 2 && found[1] == 1 );
+        }
+
+        TEST_METHOD( SmallVectorCopiesMovesAndSwapsItsOwnStorage )
+        {
+            SmallVector<std::string, 2> first{ "Cat", "Dog" };
+            SmallVector<std::string, 2> second{ "Cow", "Eagle", "Wolf" };
+            SmallVector<std::string, 2> copy( first );
+            first[0] = "Tiger";
+            Assert::IsTrue( copy[0] == "Cat" && copy.IsInline() );
+            SmallVector<std::string, 2> moved( std::move( second ) );
+            Assert::IsTrue( moved.size() == 3 && second.empty() );
+            copy.swap( moved );
+            Assert::IsTrue( copy.size() == 3 && moved.size() == 2 );
+            Assert::IsTrue( moved.IsInline() && moved[1] == "Dog" );
+            copy = first;
+            Assert::IsTrue( copy == first );
+        }
+
+        TEST_METHOD( SmallVectorAddRangeMovesIntoItsOwnStorage )
+        {
+            SmallVector<int, 4> target;
+            {
+                SmallVector<int, 4> source{ 13,2,14 };
+                target.AddRange( std::move( source ) );
+            }
+            Assert::IsTrue( target.IsInline() );
+            Assert::IsTrue( target == SmallVector<int, 4>( { 13,2,14 } ) );
+        }
+
+        TEST_METHOD( StaticVectorBuildsLookupTableAtCompileTime )
+        {
+            constexpr auto table = []()
+            {
+                StaticVector<int, 8> squares;
+                for( int i = 7; i >= 0; --i )
+                    squares.push_back( i * i );
+                squares.Sort();
+                squares.RemoveAll( []( const int& element ) { return element % 2 == 1; } );
+                return squares;
+            }();
+            static_assert( table.size() == 4 && table[3] == 36 );
+            static_assert( table.BinarySearch( 16 ) == 2 && table.BinarySearch( 5 ) == ~2 );
+            Assert::IsTrue( table.Contains( 4 ) && table.IndexOf( 36 ) == 3 );
+        }
+
+        TEST_METHOD( StaticVectorAppliesItsOverflowPolicy )
+        {
+            StaticVector<std::string, 2> throwing{ "Cat", "Dog" };
+            Assert::ExpectException<std::length_error>( [&throwing]() { throwing.push_back( "Cow" ); } );
+            StaticVector<std::string, 2, ReportOnOverflow> reporting{ "Cat" };
+            Assert::IsTrue( reporting.push_back( "Dog" ) );
+            Assert::IsFalse( reporting.push_back( "Cow" ) );
+            Assert::IsFalse( reporting.AddRange( { "Wolf" } ) );
+            Assert::IsTrue( reporting.full() && reporting.size() == 2 && reporting[1] == "Dog" );
+        }
+
+        TEST_METHOD( StaticVectorPopBackOnEmptyAppliesItsOverflowPolicy )
+        {
+            StaticVector<std::string, 2> throwing{ "Cat" };
+            throwing.pop_back();
+            Assert::ExpectException<std::out_of_range>( [&throwing]() { throwing.pop_back(); } );
+            Assert::IsTrue( throwing.empty() );
+            StaticVector<std::string, 2, ReportOnOverflow> reporting{ "Cat" };
+            Assert::IsTrue( reporting.pop_back() );
+            Assert::IsFalse( reporting.pop_back() );
+            Assert::IsTrue( reporting.empty() );
+        }
+
+        TEST_METHOD( ChunkedVectorGrowsWithoutMovingItsElements )
+        {
+            ChunkedVector<std::string, 2> chunked{ "Cat", "Dog" };
+            const std::string* first = &chunked[0];
+            auto last = chunked.begin() + 1;
+            chunked.AddRange( { "Cow", "Eagle", "Wolf" } );
+            chunked.push_back( chunked[0] );
+            Assert::IsTrue( first == &chunked[0] && *last == "Dog" );
+            Assert::IsTrue( chunked.size() == 6 && chunked.capacity() == 6 && chunked.back() == "Cat" );
+            Assert::ExpectException<std::out_of_range>( [&chunked]() { chunked.at( 6 ); } );
+        }
+
+        TEST_METHOD( ChunkedVectorFindsRemovesAndVisitsElementsAcrossChunks )
+        {
+            ChunkedVector<int, 4> chunked;
+            Vector<int> values{ 7,12,3,9,14,1,10,5,8,2 };
+            chunked.AddRange( values );
+            auto found = chunked.FindAll( []( const int& element ) { return element > 8; } );
+            Assert::IsTrue( found == ChunkedVector<int, 4>( { 12,9,14,10 } ) );
+            chunked.RemoveAll( []( const int& element ) { return element % 2 == 0; } );
+            chunked.ForEach( []( int& element ) { element *= 10; } );
+            Assert::IsTrue( chunked == ChunkedVector<int, 4>( { 70,30,90,10,50 } ) );
+            chunked.shrink_to_fit();
+            Assert::IsTrue( chunked.capacity() == 8 );
+        }
+
+        TEST_METHOD( SoAVectorSearchesAndSortsByTheListedColumns )
+        {
+            SoAVector<std::string, unsigned int> cities{ { "Warsaw", 1790658 }, { "Krakow", 779115 }, { "Tokyo", 13960000 }, { "Paris", 2161000 } };
+            auto large = cities.FindAll<1>( []( const unsigned int& population ) { return population > 2000000; } );
+            Assert::IsTrue( large.size() == 2 && large[0].Get<0>() == "Tokyo" && large[1].Get<0>() == "Paris" );
+            Assert::IsTrue( cities.FindIndex<0, 1>( []( const std::string& name, const unsigned int& population ) { return name[0] == 'P' && population > 1000000; } ) == 3 );
+            Assert::IsTrue( cities.FindIndex<1>( []( const unsigned int& population ) { return population == 0; } ) == -1 );
+            cities.Sort<1>();
+            Assert::IsTrue( cities.GetColumn<0>() == Vector<std::string>( { "Krakow", "Warsaw", "Paris", "Tokyo" } ) );
+            cities.Sort<0>( std::greater<std::string>() );
+            Assert::IsTrue( cities.GetColumn<1>() == Vector<unsigned int>( { 1790658, 13960000, 2161000, 779115 } ) );
+        }
+
+        TEST_METHOD( SoAVectorAccessesRecordsThroughProxies )
+        {
+            using Point = std::pair<int, int>;
+            Vector<Point> coordinates{ Point( 1, 4 ), Point( -3, -6 ), Point( 4, 0 ) };
+            SoAVector<int, int> points;
+            points.AddRange( coordinates );
+            points[2] = points[0];
+            points.at( 0 ).Get<1>() = 9;
+            for( auto point : points )
+                point.Get<0>() *= 2;
+            std::tuple<int, int> first = points[0];
+            Assert::IsTrue( first == std::make_tuple( 2, 9 ) );
+            Assert::IsTrue( points.ToVector<Point>() == Vector<Point>( { Point( 2, 9 ), Point( -6, -6 ), Point( 2, 4 ) } ) );
+            Assert::ExpectException<std::out_of_range>( [&points]() { points.at( 3 ); } );
+        }
+
 	};
 }